@@ -153,6 +153,9 @@ afl_parse_csv(const uchar *csv_buf, size_t buf_len, uchar sep, int nthreads,
     result->r.add_header = &afl_add_header;
     result->r.add_column = &afl_add_column;
     result->r.fix_column_type = afl_fix_column_type;
+    result->r.add_validity = NULL;
+    result->r.fix_decimal_scale = NULL;
+    result->r.add_mapped_column = NULL;
     result->buf = malloc(BUF_SIZE);
     result->buf_last = result->buf;
     result->nrows = -1;
@@ -0,0 +1,559 @@
+/*
+ * Copyright 2026 Ben Walsh
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Standalone benchmark of parse_csv() on generated datasets.
+ *
+ *   cbench [--size=MB] [--threads=N] [--repeat=R] [--only=NAME]
+ *          [--label=TEXT] [--json=FILE] [--schema]
+ *
+ * With --schema, each dataset is parsed once to find its columns, which
+ * are then given as FastCsvInput.schema, as for a feed of known layout.
+ *
+ * Each dataset is generated and parsed in a child process, so that the
+ * peak RSS reported for it is its own.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/time.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+
+#include "fastcsv.h"
+
+typedef struct {
+    char *data;
+    size_t len;
+    size_t cap;
+    uint64_t rng;
+    size_t nrows;
+} Gen;
+
+typedef struct {
+    const char *name;
+    void (*gen_row)(Gen *);
+} Dataset;
+
+typedef struct {
+    FastCsvResult r;
+    void **cols;
+    FastCsvSchemaColumn *found;  /* type and width of each column added */
+    int ncols;
+    int cap;
+    size_t nrows;
+} BenchResult;
+
+static uint64_t
+gen_rand(Gen *g)
+{
+    /* xorshift64*, deterministic for a given seed */
+    g->rng ^= g->rng >> 12;
+    g->rng ^= g->rng << 25;
+    g->rng ^= g->rng >> 27;
+    return g->rng * 2685821657736338717ULL;
+}
+
+static void
+gen_put(Gen *g, const char *s, size_t n)
+{
+    if (g->len + n > g->cap) {
+        g->cap = (g->len + n) * 2;
+        g->data = (char *)realloc(g->data, g->cap);
+    }
+    memcpy(g->data + g->len, s, n);
+    g->len += n;
+}
+
+static void
+gen_putc(Gen *g, char c)
+{
+    gen_put(g, &c, 1);
+}
+
+static void
+gen_int(Gen *g, int64_t lo, int64_t hi)
+{
+    char buf[32];
+    int n = sprintf(buf, "%lld", (long long)(lo + (int64_t)(gen_rand(g) % (uint64_t)(hi - lo + 1))));
+    gen_put(g, buf, n);
+}
+
+static void
+gen_double(Gen *g)
+{
+    char buf[64];
+    double v = (double)(int64_t)(gen_rand(g) % 2000000000) / 1000.0 - 1000000.0;
+    int n = sprintf(buf, "%.6f", v);
+    gen_put(g, buf, n);
+}
+
+static void
+gen_word(Gen *g, int minlen, int maxlen)
+{
+    int i, n = minlen + (int)(gen_rand(g) % (maxlen - minlen + 1));
+    for (i = 0; i < n; i++) {
+        gen_putc(g, 'a' + (char)(gen_rand(g) % 26));
+    }
+}
+
+static void
+gen_text(Gen *g, int minlen, int maxlen, int newlines)
+{
+    static const char punct[] = " ,.;\"";
+    int i, n = minlen + (int)(gen_rand(g) % (maxlen - minlen + 1));
+
+    gen_putc(g, '"');
+    for (i = 0; i < n; i++) {
+        uint64_t r = gen_rand(g) % 64;
+        if (r < sizeof(punct) - 1) {
+            if (punct[r] == '"') {
+                gen_putc(g, '"');  /* escaped */
+            }
+            gen_putc(g, punct[r]);
+        } else if (newlines && r == 63) {
+            gen_putc(g, '\n');
+        } else {
+            gen_putc(g, 'a' + (char)(r % 26));
+        }
+    }
+    gen_putc(g, '"');
+}
+
+static void
+row_narrow_ints(Gen *g)
+{
+    int i;
+    for (i = 0; i < 8; i++) {
+        if (i > 0) {
+            gen_putc(g, ',');
+        }
+        gen_int(g, -100, 100);
+    }
+    gen_putc(g, '\n');
+}
+
+static void
+row_wide_doubles(Gen *g)
+{
+    int i;
+    for (i = 0; i < 32; i++) {
+        if (i > 0) {
+            gen_putc(g, ',');
+        }
+        gen_double(g);
+    }
+    gen_putc(g, '\n');
+}
+
+static void
+row_short_strings(Gen *g)
+{
+    int i;
+    for (i = 0; i < 8; i++) {
+        if (i > 0) {
+            gen_putc(g, ',');
+        }
+        gen_word(g, 2, 10);
+    }
+    gen_putc(g, '\n');
+}
+
+static void
+row_long_strings(Gen *g)
+{
+    gen_word(g, 100, 400);
+    gen_putc(g, ',');
+    gen_word(g, 100, 400);
+    gen_putc(g, '\n');
+}
+
+static void
+row_quoted_text(Gen *g)
+{
+    int i;
+    for (i = 0; i < 4; i++) {
+        if (i > 0) {
+            gen_putc(g, ',');
+        }
+        gen_text(g, 10, 80, 0);
+    }
+    gen_putc(g, '\n');
+}
+
+static void
+row_embedded_newlines(Gen *g)
+{
+    gen_int(g, 0, 1000000);
+    gen_putc(g, ',');
+    gen_text(g, 20, 200, 1);
+    gen_putc(g, '\n');
+}
+
+static void
+row_ragged(Gen *g)
+{
+    int i, n = 1 + (int)(gen_rand(g) % 12);
+    for (i = 0; i < n; i++) {
+        if (i > 0) {
+            gen_putc(g, ',');
+        }
+        gen_int(g, 0, 100000);
+    }
+    gen_putc(g, '\n');
+}
+
+static void
+row_mixed(Gen *g)
+{
+    gen_int(g, 0, 1000000000);
+    gen_putc(g, ',');
+    gen_double(g);
+    gen_putc(g, ',');
+    gen_word(g, 3, 12);
+    gen_putc(g, ',');
+    if (gen_rand(g) % 4 != 0) {
+        gen_int(g, -5, 5);
+    }
+    gen_putc(g, ',');
+    gen_text(g, 0, 30, 0);
+    gen_putc(g, ',');
+    gen_double(g);
+    gen_putc(g, '\n');
+}
+
+static const Dataset datasets[] = {
+    {"narrow_ints", row_narrow_ints},
+    {"wide_doubles", row_wide_doubles},
+    {"short_strings", row_short_strings},
+    {"long_strings", row_long_strings},
+    {"quoted_text", row_quoted_text},
+    {"embedded_newlines", row_embedded_newlines},
+    {"ragged", row_ragged},
+    {"mixed", row_mixed},
+    {NULL, NULL}
+};
+
+static void
+generate(const Dataset *dataset, size_t size, Gen *g)
+{
+    g->data = NULL;
+    g->len = g->cap = 0;
+    g->rng = 0x9e3779b97f4a7c15ULL;
+    g->nrows = 0;
+    while (g->len < size) {
+        dataset->gen_row(g);
+        g->nrows++;
+    }
+}
+
+static void *
+bench_add_column(FastCsvResult *res, int col_type, size_t nrows, size_t width)
+{
+    BenchResult *bres = (BenchResult *)res;
+    size_t elem_size;
+
+    switch (col_type) {
+    case COL_TYPE_INT32:
+        elem_size = sizeof(int32_t);
+        break;
+    case COL_TYPE_INT64:
+        elem_size = sizeof(int64_t);
+        break;
+    case COL_TYPE_DOUBLE:
+        elem_size = sizeof(double);
+        break;
+    default:
+        elem_size = width;
+        break;
+    }
+
+    if (bres->ncols >= bres->cap) {
+        bres->cap = bres->cap * 2 + 16;
+        bres->cols = (void **)realloc(bres->cols, bres->cap * sizeof(void *));
+        bres->found = (FastCsvSchemaColumn *)realloc(bres->found,
+                                                     bres->cap * sizeof(FastCsvSchemaColumn));
+    }
+    bres->found[bres->ncols].type = col_type;
+    bres->found[bres->ncols].width = width;
+    bres->nrows = nrows;
+    return bres->cols[bres->ncols++] = malloc(nrows * elem_size + 1);
+}
+
+static int
+bench_add_header(FastCsvResult *res, const uchar *str, size_t len)
+{
+    return 0;
+}
+
+static double
+now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/* If schema is not NULL, it is given to the parser, else set to the
+   columns found, to be freed by the caller. */
+static double
+bench_parse(const Gen *g, int nthreads, size_t *nrows, FastCsvStats *stats,
+            FastCsvSchemaColumn **schema, int *schema_ncols)
+{
+    FastCsvInput input;
+    BenchResult result;
+    double t0, t1;
+    int i, rc;
+
+    init_csv(&input, (const uchar *)g->data, g->len, 0, nthreads);
+    input.stats = stats;
+    if (*schema != NULL) {
+        input.schema_ncols = *schema_ncols;
+        input.schema = *schema;
+    }
+
+    result.r.add_header = &bench_add_header;
+    result.r.add_column = &bench_add_column;
+    result.r.fix_column_type = NULL;
+    result.r.add_validity = NULL;
+    result.r.fix_decimal_scale = NULL;
+    result.r.add_mapped_column = NULL;
+    result.cols = NULL;
+    result.found = NULL;
+    result.ncols = result.cap = 0;
+    result.nrows = 0;
+
+    t0 = now();
+    rc = parse_csv(&input, (FastCsvResult *)&result);
+    t1 = now();
+    if (rc != 0) {
+        fprintf(stderr, "parse_csv failed with %d\n", rc);
+        exit(1);
+    }
+
+    for (i = 0; i < result.ncols; i++) {
+        free(result.cols[i]);
+    }
+    free(result.cols);
+    if (*schema == NULL) {
+        *schema = result.found;
+        *schema_ncols = result.ncols;
+    } else {
+        free(result.found);
+    }
+
+    *nrows = result.nrows;
+
+    return t1 - t0;
+}
+
+/* Write str as a JSON string. */
+static void
+json_string(FILE *out, const char *str)
+{
+    const unsigned char *p;
+
+    fputc('"', out);
+    for (p = (const unsigned char *)str; *p != '\0'; p++) {
+        if (*p == '"' || *p == '\\') {
+            fprintf(out, "\\%c", *p);
+        } else if (*p < 0x20) {
+            fprintf(out, "\\u%04x", *p);
+        } else {
+            fputc(*p, out);
+        }
+    }
+    fputc('"', out);
+}
+
+static void
+run_dataset(FILE *out, const Dataset *dataset, size_t size, int max_threads, int repeat,
+            int use_schema)
+{
+    Gen g;
+    int nthreads, i;
+    double gen_time;
+    FastCsvSchemaColumn *schema = NULL;
+    int schema_ncols = 0;
+
+    gen_time = now();
+    generate(dataset, size, &g);
+    gen_time = now() - gen_time;
+
+    fprintf(stderr, "%-18s %8.1f MB %10lu rows (generated in %.2fs)\n",
+            dataset->name, g.len / 1e6, (unsigned long)g.nrows, gen_time);
+
+    fprintf(out, "{\"name\": \"%s\", \"bytes\": %lu, \"rows\": %lu, \"runs\": [",
+            dataset->name, (unsigned long)g.len, (unsigned long)g.nrows);
+
+    if (use_schema) {
+        size_t nrows;
+        FastCsvStats stats;
+        bench_parse(&g, max_threads, &nrows, &stats, &schema, &schema_ncols);
+        free_csv_stats(&stats);
+    }
+
+    for (nthreads = 1; nthreads <= max_threads; nthreads++) {
+        double best = 0.0;
+        size_t nrows = 0;
+        FastCsvStats stats, best_stats;
+        for (i = 0; i < repeat; i++) {
+            FastCsvSchemaColumn *found = schema;
+            double t = bench_parse(&g, nthreads, &nrows, &stats, &found, &schema_ncols);
+            if (found != schema) {
+                free(found);
+            }
+            if (i == 0 || t < best) {
+                best = t;
+                best_stats = stats;
+            }
+            free_csv_stats(&stats);
+        }
+        fprintf(stderr, "    threads %3d  %8.3fs  %7.3f GB/s  %8.2f Mrows/s"
+                "  (stage1 %.3f fixup %.3f allocate %.3f fill %.3f)\n",
+                nthreads, best, g.len / best / 1e9, nrows / best / 1e6,
+                best_stats.stage1_end - best_stats.stage1_begin,
+                best_stats.fixup_end - best_stats.fixup_begin,
+                best_stats.allocate_end - best_stats.allocate_begin,
+                best_stats.fill_end - best_stats.fill_begin);
+        fprintf(out, "%s{\"threads\": %d, \"seconds\": %.6f, \"gb_per_s\": %.6f, "
+                "\"rows_per_s\": %.1f, \"stage1\": %.6f, \"fixup\": %.6f, "
+                "\"allocate\": %.6f, \"add_column\": %.6f, \"fill\": %.6f, "
+                "\"queue_wait\": %.6f, \"fixup_bytes\": %lu}",
+                (nthreads > 1) ? ", " : "", nthreads, best,
+                g.len / best / 1e9, nrows / best,
+                best_stats.stage1_end - best_stats.stage1_begin,
+                best_stats.fixup_end - best_stats.fixup_begin,
+                best_stats.allocate_end - best_stats.allocate_begin,
+                best_stats.add_column_time,
+                best_stats.fill_end - best_stats.fill_begin,
+                best_stats.queue_wait, (unsigned long)best_stats.fixup_bytes);
+    }
+
+    fprintf(out, "]");
+
+    free(schema);
+    free(g.data);
+}
+
+int
+main(int argc, char *argv[])
+{
+    size_t size = 64;
+    int max_threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    int repeat = 3;
+    const char *only = NULL;
+    const char *label = "";
+    const char *json_fname = NULL;
+    int use_schema = 0;
+    const Dataset *dataset;
+    FILE *json = stdout;
+    int i, first = 1;
+
+    for (i = 1; i < argc; i++) {
+        if (strncmp(argv[i], "--size=", 7) == 0) {
+            size = strtoul(argv[i] + 7, NULL, 10);
+        } else if (strncmp(argv[i], "--threads=", 10) == 0) {
+            max_threads = atoi(argv[i] + 10);
+        } else if (strncmp(argv[i], "--repeat=", 9) == 0) {
+            repeat = atoi(argv[i] + 9);
+        } else if (strncmp(argv[i], "--only=", 7) == 0) {
+            only = argv[i] + 7;
+        } else if (strncmp(argv[i], "--label=", 8) == 0) {
+            label = argv[i] + 8;
+        } else if (strncmp(argv[i], "--json=", 7) == 0) {
+            json_fname = argv[i] + 7;
+        } else if (strcmp(argv[i], "--schema") == 0) {
+            use_schema = 1;
+        } else {
+            fprintf(stderr, "usage: %s [--size=MB] [--threads=N] [--repeat=R] "
+                    "[--only=NAME] [--label=TEXT] [--json=FILE] [--schema]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (max_threads < 1) {
+        max_threads = 1;
+    }
+    if (repeat < 1) {
+        repeat = 1;
+    }
+
+    if (json_fname != NULL && (json = fopen(json_fname, "w")) == NULL) {
+        perror(json_fname);
+        return 1;
+    }
+
+    fprintf(json, "{\"label\": ");
+    json_string(json, label);
+    fprintf(json, ", \"ncpus\": %ld, \"size_mb\": %lu, \"datasets\": [\n",
+            sysconf(_SC_NPROCESSORS_ONLN), (unsigned long)size);
+
+    for (dataset = datasets; dataset->name != NULL; dataset++) {
+        int fds[2];
+        pid_t pid;
+        int status;
+        struct rusage usage;
+        char buf[4096];
+        ssize_t n;
+
+        if (only != NULL && strcmp(only, dataset->name) != 0) {
+            continue;
+        }
+
+        if (pipe(fds) != 0 || (pid = fork()) < 0) {
+            perror("fork");
+            return 1;
+        }
+
+        if (pid == 0) {
+            FILE *out;
+            close(fds[0]);
+            out = fdopen(fds[1], "w");
+            run_dataset(out, dataset, size * 1000000, max_threads, repeat, use_schema);
+            fclose(out);
+            _exit(0);
+        }
+
+        close(fds[1]);
+        fprintf(json, "%s  ", first ? "" : ",\n");
+        while ((n = read(fds[0], buf, sizeof(buf))) > 0) {
+            fwrite(buf, 1, n, json);
+        }
+        close(fds[0]);
+
+        if (wait4(pid, &status, 0, &usage) < 0 || !WIFEXITED(status)
+            || WEXITSTATUS(status) != 0) {
+            fprintf(stderr, "%s: benchmark failed\n", dataset->name);
+            return 1;
+        }
+        fprintf(stderr, "    peak rss %ld kB\n", usage.ru_maxrss);
+        fprintf(json, ", \"peak_rss_kb\": %ld}", usage.ru_maxrss);
+        first = 0;
+    }
+
+    fprintf(json, "\n]}\n");
+
+    if (json != stdout) {
+        fclose(json);
+    }
+
+    return 0;
+}
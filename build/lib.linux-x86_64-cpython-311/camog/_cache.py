@@ -0,0 +1,161 @@
+# Copyright 2026 Ben Walsh
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Cache file layout (all integers little-endian):
+#
+#   magic     8 bytes  b'CAMOGC01'
+#   size      uint64   size of the csv file
+#   mtime     uint64   mtime of the csv file in nanoseconds
+#   meta_len  uint64   length of the json metadata
+#   meta      json     headers, and (dtype, nrows, offset) for each column
+#   data      columns, each starting on a _ALIGN byte boundary; offsets
+#             are relative to the first _ALIGN boundary after meta
+#
+# Only the fixed size prefix is read to validate the cache.
+
+import os
+import sys
+import json
+import mmap
+import struct
+import hashlib
+import tempfile
+import threading
+
+import numpy as np
+
+_MAGIC = b'CAMOGC01'
+_PREFIX = struct.Struct('<8sQQQ')
+_ALIGN = 64
+
+_writers = []
+_writers_lock = threading.Lock()
+
+
+def file_key(filename):
+    st = os.stat(filename)
+    mtime_ns = getattr(st, 'st_mtime_ns', None)
+    if mtime_ns is None:
+        mtime_ns = int(st.st_mtime * 1e9)
+    return st.st_size, mtime_ns
+
+
+def cache_filename(cache_dir, filename, options):
+    # options must have a stable repr
+    key = repr((os.path.abspath(filename), options))
+    return os.path.join(cache_dir,
+                        hashlib.sha1(key.encode('utf8')).hexdigest() + '.camog')
+
+
+def _align(n):
+    return (n + _ALIGN - 1) // _ALIGN * _ALIGN
+
+
+def _encode_headers(headers):
+    if headers is None:
+        return None
+    return [[h.decode('latin1'), 1] if isinstance(h, bytes) else [h, 0]
+            for h in headers]
+
+
+def _decode_headers(headers):
+    if headers is None:
+        return None
+    return [h.encode('latin1') if is_bytes else h for h, is_bytes in headers]
+
+
+def read(path, key):
+    try:
+        fp = open(path, 'rb')
+    except (IOError, OSError):
+        return None
+
+    with fp:
+        prefix = fp.read(_PREFIX.size)
+        if len(prefix) != _PREFIX.size:
+            return None
+        magic, size, mtime_ns, meta_len = _PREFIX.unpack(prefix)
+        if magic != _MAGIC or (size, mtime_ns) != key:
+            return None
+
+        meta = json.loads(fp.read(meta_len).decode('utf8'))
+
+        # private mapping so callers can still write to the arrays
+        mm = mmap.mmap(fp.fileno(), 0, access=mmap.ACCESS_COPY)
+
+    data_begin = _align(_PREFIX.size + meta_len)
+    columns = [np.frombuffer(mm, dtype=np.dtype(dtype), count=nrows,
+                             offset=data_begin + offset)
+               for dtype, nrows, offset in meta['columns']]
+
+    return _decode_headers(meta['headers']), columns
+
+
+def _write(path, key, headers, columns):
+    meta = {'headers': _encode_headers(headers), 'columns': []}
+    offset = 0
+    for col in columns:
+        meta['columns'].append([col.dtype.str, len(col), offset])
+        offset = _align(offset + col.nbytes)
+    data_len = offset
+
+    meta_bytes = json.dumps(meta).encode('utf8')
+    data_begin = _align(_PREFIX.size + len(meta_bytes))
+
+    fd, tmp_path = tempfile.mkstemp(dir=os.path.dirname(path), suffix='.tmp')
+    try:
+        with os.fdopen(fd, 'wb') as fp:
+            fp.write(_PREFIX.pack(_MAGIC, key[0], key[1], len(meta_bytes)))
+            fp.write(meta_bytes)
+            for col, (_, _, offset) in zip(columns, meta['columns']):
+                fp.write(b'\0' * (data_begin + offset - fp.tell()))
+                fp.write(np.ascontiguousarray(col).data)
+            fp.write(b'\0' * (data_begin + data_len - fp.tell()))
+        if sys.version_info >= (3, 3):
+            os.replace(tmp_path, path)
+        else:
+            os.rename(tmp_path, path)
+    except Exception:
+        os.unlink(tmp_path)
+        raise
+
+
+def _write_and_release(path, key, headers, columns, locked):
+    try:
+        _write(path, key, headers, columns)
+    finally:
+        for col in locked:
+            col.setflags(write=True)
+
+
+def write_async(path, key, headers, columns):
+    # The writer reads the caller's arrays, so they are read-only until it
+    # is done rather than copied.
+    locked = [col for col in columns if col.flags.writeable]
+    for col in locked:
+        col.setflags(write=False)
+    thread = threading.Thread(target=_write_and_release,
+                              args=(path, key, headers, columns, locked))
+    with _writers_lock:
+        _writers[:] = [t for t in _writers if t.is_alive()]
+        _writers.append(thread)
+    thread.start()
+
+
+def wait():
+    with _writers_lock:
+        threads = list(_writers)
+        del _writers[:]
+    for thread in threads:
+        thread.join()
@@ -0,0 +1,101 @@
+# Copyright 2026 Ben Walsh
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Row index file layout (all integers little-endian):
+#
+#   magic     8 bytes  b'CAMOGI01'
+#   size      uint64   size of the csv file
+#   mtime     uint64   mtime of the csv file in nanoseconds
+#   sep       uint8    separator, which decides where quotes start
+#   nheaders  uint8
+#   step      uint64   rows between samples
+#   nrows     uint64   data rows
+#   offsets   uint64   byte offset of rows 0, step, 2 * step, ..., then
+#                      the size of the csv file
+#
+# Rows begin outside quotes, so a range of rows from the offsets can be
+# parsed on its own.
+
+import os
+import sys
+import struct
+import tempfile
+
+import numpy as np
+
+_MAGIC = b'CAMOGI01'
+_PREFIX = struct.Struct('<8sQQBB6xQQ')
+
+
+def index_filename(filename):
+    return filename + '.camogidx'
+
+
+class RowIndex(object):
+    def __init__(self, step, nrows, offsets):
+        self.step = step
+        self.nrows = nrows
+        self.offsets = offsets  # nblocks + 1
+
+    @property
+    def data_begin(self):
+        return int(self.offsets[0])
+
+    def block_range(self, first, last):
+        """Byte range of the blocks first to last, inclusive."""
+
+        return int(self.offsets[first]), int(self.offsets[last + 1])
+
+    def block_rows(self, block):
+        return min(self.step, self.nrows - block * self.step)
+
+
+def read(path, key, sep, nheaders):
+    try:
+        fp = open(path, 'rb')
+    except (IOError, OSError):
+        return None
+
+    with fp:
+        prefix = fp.read(_PREFIX.size)
+        if len(prefix) != _PREFIX.size:
+            return None
+        magic, size, mtime_ns, idx_sep, idx_nheaders, step, nrows = _PREFIX.unpack(prefix)
+        if (magic != _MAGIC or (size, mtime_ns) != key or idx_sep != ord(sep)
+                or idx_nheaders != nheaders):
+            return None
+        nblocks = (nrows + step - 1) // step
+        offsets = np.frombuffer(fp.read(8 * (nblocks + 1)), dtype='<u8')
+        if len(offsets) != nblocks + 1:
+            return None
+
+    return RowIndex(step, nrows, offsets)
+
+
+def write(path, key, sep, nheaders, step, nrows, offsets):
+    offsets = np.append(np.asarray(offsets, dtype='<u8'), np.uint64(key[0]))
+    fd, tmp_path = tempfile.mkstemp(dir=os.path.dirname(os.path.abspath(path)), suffix='.tmp')
+    try:
+        with os.fdopen(fd, 'wb') as fp:
+            fp.write(_PREFIX.pack(_MAGIC, key[0], key[1], ord(sep), nheaders, step, nrows))
+            fp.write(offsets.tobytes())
+        if sys.version_info >= (3, 3):
+            os.replace(tmp_path, path)
+        else:
+            os.rename(tmp_path, path)
+    except Exception:
+        os.unlink(tmp_path)
+        raise
+
+    return RowIndex(step, nrows, offsets)
@@ -12,4 +12,4 @@
 # See the License for the specific language governing permissions and
 # limitations under the License.
 
-from camog._csv import load, loads
+from camog._csv import load, loads, load_many, aggregate, dump, read_frame, open, scan, Table, build_index, take, Tail
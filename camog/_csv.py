@@ -12,9 +12,17 @@
 # See the License for the specific language governing permissions and
 # limitations under the License.
 
+import glob
+import io
 import multiprocessing
+import os
+
+import numpy as np
 
 from . import _cfastcsv
+from . import _cache
+from . import _filter
+from . import _index
 
 
 def _check_args(sep, headers, nthreads):
@@ -31,22 +39,846 @@ def _check_args(sep, headers, nthreads):
     return nthreads, nheaders
 
 
+_VALIDITY = (None, 'bitmap', 'mask')
+
+_NARROW = {'off': 0, 'int_only': 1, 'auto': 2}
+
+
+def _check_na(na_values, validity):
+    if validity not in _VALIDITY:
+        raise ValueError('Invalid validity %r' % (validity,))
+    if na_values is None:
+        return None
+    if isinstance(na_values, (bytes, type(u''))):
+        na_values = [na_values]
+    return [v if isinstance(v, bytes) else v.encode('utf8') for v in na_values]
+
+
+def _check_narrow(narrow):
+    if narrow not in _NARROW:
+        raise ValueError('Invalid narrow %r' % (narrow,))
+    return _NARROW[narrow]
+
+
+def _check_memory_limit(memory_limit):
+    if memory_limit is None:
+        return 0
+    if not isinstance(memory_limit, int) or memory_limit <= 0:
+        raise ValueError('Invalid memory_limit %r' % (memory_limit,))
+    return memory_limit
+
+
+def _check_schema(schema, col_to_type, narrow, decimals):
+    if schema is None:
+        return None
+    if col_to_type is not None or narrow != 'off':
+        raise ValueError('schema cannot be used with col_to_type or narrow')
+    if decimals is not None and any(scale is None for scale in decimals.values()):
+        raise ValueError('decimals need a scale with a schema')
+    schema = list(schema)
+    if not schema:
+        raise ValueError('schema needs at least one column')
+    return schema
+
+
+def _check_out(out, memory_limit):
+    if out is None:
+        return None
+    if memory_limit is not None:
+        raise ValueError('out cannot be used with memory_limit')
+    return list(out)
+
+
+def _check_partition(partition_by, npartitions, validity, memory_limit):
+    if partition_by is None:
+        if npartitions is not None:
+            raise ValueError('npartitions needs partition_by')
+        return None
+    if not isinstance(npartitions, int) or not 1 <= npartitions <= 65536:
+        raise ValueError('Invalid npartitions %r' % (npartitions,))
+    if validity is not None or memory_limit is not None:
+        raise ValueError('partition_by cannot be used with validity or memory_limit')
+    if isinstance(partition_by, int):
+        return partition_by
+    return partition_by if isinstance(partition_by, bytes) else partition_by.encode('utf8')
+
+
+def _check_decimals(decimals):
+    if decimals is None:
+        return None
+    if not isinstance(decimals, dict):
+        decimals = dict((col, None) for col in decimals)
+    for col, scale in decimals.items():
+        if scale is not None and (not isinstance(scale, int) or not 0 <= scale <= 18):
+            raise ValueError('Invalid decimal scale %r for %r' % (scale, col))
+    return decimals
+
+
+def _with_validity(res, validity):
+    """With validity='mask', the validity bitmaps (the last element of res)
+    become the masks of the columns."""
+
+    if validity != 'mask':
+        return res
+
+    columns = []
+    for col, bitmap in zip(res[1], res[-1]):
+        if bitmap is None:
+            columns.append(np.ma.MaskedArray(col))
+        else:
+            bits = np.unpackbits(bitmap[:, None], axis=1)[:, ::-1].ravel()[:len(col)]
+            columns.append(np.ma.MaskedArray(col, mask=(bits == 0)))
+
+    return (res[0], columns) + tuple(res[2:-1])
+
+
 def load(filename, sep=',', headers=True, nthreads=None, flags=0, col_to_type=None,
-         missing_int_val=0, missing_float_val=0.0):
+         missing_int_val=0, missing_float_val=0.0, cache_dir=None, return_stats=False,
+         trace=None, filter=None, return_summary=False, na_values=None, validity=None,
+         narrow='off', decimals=None, rows=None, memory_limit=None, spill_dir=None,
+         schema=None, partition_by=None, npartitions=None, out=None):
+    """na_values are strings read as missing values, as well as empty
+    cells.  validity='bitmap' adds a list with an Arrow style validity
+    bitmap (or None if there are no nulls) for each column to the result,
+    and validity='mask' gives numpy masked arrays instead.
+
+    narrow='int_only' gives integer columns the smallest of int8, int16,
+    int32 and int64 that is sure to hold them, judging by the length of
+    the cells, and narrow='auto' also gives float32 to float columns with
+    at most 7 characters and no exponent.  col_to_type takes numpy types
+    too, eg. np.float32.
+
+    decimals maps columns to a scale, or None for the most digits after
+    the decimal point in the column, and those columns are int64 holding
+    the value times 10 ** scale, with no floating point on the way.  The
+    scale of each column (None if not decimal) is added to the result,
+    before the validity bitmaps.
+
+    rows is a slice of the data rows to load, which are found with the
+    row index (see build_index), so only the blocks of rows holding them
+    are parsed.  Column types are then inferred from those blocks.
+
+    If the columns would take more than memory_limit bytes, counting the
+    buffers used while parsing, they are filled in unlinked files in
+    spill_dir (by default the temp dir) and paged out as they fill, so
+    they can be bigger than memory.
+
+    schema is a type for every column, as in col_to_type, so no types are
+    inferred and parsing starts by only finding the rows.  Strings keep
+    at most the width of a numpy type such as 'S8', and str or bytes are
+    as wide as the widest cell.  Cells past the last column are dropped.
+
+    partition_by is a key column whose values are hashed as they are
+    loaded to split the rows into npartitions, and the columns in the
+    result become a list of npartitions lists of columns, each with the
+    rows of one partition in file order.  The same key value goes to the
+    same partition in every file.
+
+    out is an array for each column to fill instead of new ones, such as
+    the arrays of an earlier load, each with the dtype the column would
+    get (so a schema helps) and at least as many rows.  The columns are
+    then views of the first rows of those arrays.
+
+    With cache_dir, the parsed columns are also written to a cache file
+    there in the background, and are read-only until that is done."""
+
     if not isinstance(filename, str):
         raise ValueError('Invalid filename %r' % (filename,))
 
     nthreads, nheaders = _check_args(sep, headers, nthreads)
+    if filter is not None:
+        filter = _filter.normalize(filter)
+    na_values = _check_na(na_values, validity)
+    decimals = _check_decimals(decimals)
+    schema = _check_schema(schema, col_to_type, narrow, decimals)
+    narrow = _check_narrow(narrow)
+    partition_by = _check_partition(partition_by, npartitions, validity, memory_limit)
+    out = _check_out(out, memory_limit)
 
-    return _cfastcsv.parse_file(filename, sep, nthreads, flags,
-                                nheaders, missing_int_val, missing_float_val,
-                                col_to_type)
+    if rows is not None:
+        if (return_stats or return_summary or filter is not None or validity == 'bitmap'
+                or partition_by is not None or out is not None):
+            raise ValueError('rows cannot be used with return_stats, return_summary, filter,'
+                             ' bitmaps, partition_by or out')
+        index = _row_index(filename, sep, nheaders, nthreads, flags)
+        start, stop, step = rows.indices(index.nrows)
+        if step != 1:
+            raise ValueError('Invalid rows %r' % (rows,))
+        return _load_rows(filename, index, slice(start, max(start, stop)), sep, nheaders,
+                          nthreads, flags, col_to_type, missing_int_val, missing_float_val,
+                          na_values, validity, narrow, decimals, schema)
+
+    use_cache = (cache_dir is not None and not return_stats and not return_summary
+                 and trace is None and validity is None and decimals is None
+                 and memory_limit is None and partition_by is None and out is None)
+
+    if use_cache:
+        options = (sep, flags, nheaders, missing_int_val, missing_float_val,
+                   sorted((col_to_type or {}).items(), key=repr), filter, na_values, narrow)
+        if schema is not None:
+            options += (schema,)
+        cache_path = _cache.cache_filename(cache_dir, filename, options)
+        cache_key = _cache.file_key(filename)
+        res = _cache.read(cache_path, cache_key)
+        if res is not None:
+            return res
+
+    res = _cfastcsv.parse_file(filename, sep, nthreads, flags,
+                               nheaders, missing_int_val, missing_float_val,
+                               col_to_type, return_stats=return_stats, trace=trace,
+                               filter=filter, return_summary=return_summary,
+                               na_values=na_values, return_validity=validity is not None,
+                               narrow=narrow, decimals=decimals,
+                               memory_limit=_check_memory_limit(memory_limit),
+                               spill_dir=spill_dir, schema=schema, partition_by=partition_by,
+                               npartitions=npartitions or 0, out=out)
+
+    if use_cache:
+        _cache.write_async(cache_path, cache_key, *res)
+
+    return _with_validity(res, validity)
 
 
 def loads(s, sep=',', headers=True, nthreads=None, flags=0, col_to_type=None,
-          missing_int_val=0, missing_float_val=0.0):
+          missing_int_val=0, missing_float_val=0.0, return_stats=False,
+          trace=None, filter=None, return_summary=False, na_values=None, validity=None,
+          narrow='off', decimals=None, schema=None, out=None):
+    nthreads, nheaders = _check_args(sep, headers, nthreads)
+    if filter is not None:
+        filter = _filter.normalize(filter)
+    na_values = _check_na(na_values, validity)
+    decimals = _check_decimals(decimals)
+    schema = _check_schema(schema, col_to_type, narrow, decimals)
+    narrow = _check_narrow(narrow)
+
+    res = _cfastcsv.parse_csv(s, sep, nthreads, flags,
+                              nheaders, missing_int_val, missing_float_val,
+                              col_to_type, return_stats=return_stats, trace=trace,
+                              filter=filter, return_summary=return_summary,
+                              na_values=na_values, return_validity=validity is not None,
+                              narrow=narrow, decimals=decimals, schema=schema,
+                              out=_check_out(out, None))
+
+    return _with_validity(res, validity)
+
+
+def load_many(filenames, sep=',', headers=True, nthreads=None, flags=0, col_to_type=None,
+              missing_int_val=0, missing_float_val=0.0, return_stats=False,
+              trace=None, filter=None, return_summary=False, na_values=None,
+              validity=None, narrow='off', decimals=None, memory_limit=None, spill_dir=None,
+              schema=None, out=None):
+    """Load the files, or the files matching a glob, as one csv, rows in
+    file order.  With headers, every file must have the same header line."""
+    if isinstance(filenames, str):
+        filenames = sorted(glob.glob(filenames))
+    else:
+        filenames = list(filenames)
+    if not filenames:
+        raise ValueError('No files to load')
+    for filename in filenames:
+        if not isinstance(filename, str):
+            raise ValueError('Invalid filename %r' % (filename,))
+
+    nthreads, nheaders = _check_args(sep, headers, nthreads)
+    if filter is not None:
+        filter = _filter.normalize(filter)
+    na_values = _check_na(na_values, validity)
+    decimals = _check_decimals(decimals)
+    schema = _check_schema(schema, col_to_type, narrow, decimals)
+    narrow = _check_narrow(narrow)
+    out = _check_out(out, memory_limit)
+
+    res = _cfastcsv.parse_files(filenames, sep, nthreads, flags,
+                                nheaders, missing_int_val, missing_float_val,
+                                col_to_type, return_stats=return_stats, trace=trace,
+                                filter=filter, return_summary=return_summary,
+                                na_values=na_values, return_validity=validity is not None,
+                                narrow=narrow, decimals=decimals,
+                                memory_limit=_check_memory_limit(memory_limit),
+                                spill_dir=spill_dir, schema=schema, out=out)
+
+    return _with_validity(res, validity)
+
+
+def _make_index(filename, step, sep, nheaders, nthreads, flags):
+    key = _cache.file_key(filename)
+    _, table, nrows, _ = _cfastcsv.open_file(filename, sep, nthreads, flags, nheaders)
+    offsets = _cfastcsv.row_offsets(table, step)
+    return key, nrows, offsets
+
+
+def build_index(filename, step=4096, sep=',', headers=True, nthreads=None, flags=0):
+    """Save the byte offset of every step-th row of the csv next to it,
+    for load(rows=...) and take.  This costs about stage 1 of load.
+    Returns the index filename."""
+
+    if not isinstance(filename, str):
+        raise ValueError('Invalid filename %r' % (filename,))
+    if step <= 0:
+        raise ValueError('Invalid step %r' % (step,))
+    nthreads, nheaders = _check_args(sep, headers, nthreads)
+
+    path = _index.index_filename(filename)
+    key, nrows, offsets = _make_index(filename, step, sep, nheaders, nthreads, flags)
+    _index.write(path, key, sep, nheaders, step, nrows, offsets)
+
+    return path
+
+
+def _row_index(filename, sep, nheaders, nthreads, flags):
+    """The saved row index, or a new one, saved if possible."""
+
+    path = _index.index_filename(filename)
+    index = _index.read(path, _cache.file_key(filename), sep, nheaders)
+    if index is not None:
+        return index
+
+    step = 4096
+    key, nrows, offsets = _make_index(filename, step, sep, nheaders, nthreads, flags)
+    try:
+        return _index.write(path, key, sep, nheaders, step, nrows, offsets)
+    except (IOError, OSError):
+        return _index.RowIndex(step, nrows, np.append(offsets, np.uint64(key[0])))
+
+
+def _by_index(cols, csv_headers):
+    """Keyed by column number, as the blocks are parsed without headers."""
+
+    if cols is None or csv_headers is None:
+        return cols
+    return dict((csv_headers.index(col) if col in csv_headers else col, val)
+                for col, val in cols.items())
+
+
+def _load_rows(filename, index, row_ids, sep, nheaders, nthreads, flags, col_to_type,
+               missing_int_val, missing_float_val, na_values, validity, narrow, decimals,
+               schema=None):
+    """row_ids is a slice, with start <= stop, or an array of row numbers."""
+
+    step = index.step
+    csv_headers = None
+    if nheaders:
+        csv_headers = _cfastcsv.parse_file(filename, sep, 1, flags, nheaders,
+                                           ranges=[(0, index.data_begin)])[0]
+
+    if isinstance(row_ids, slice):
+        if row_ids.start < row_ids.stop:
+            blocks = np.arange(row_ids.start // step, (row_ids.stop - 1) // step + 1)
+        else:
+            blocks = np.zeros(min(index.nrows, 1), dtype=np.int64)
+    else:
+        blocks = np.unique(row_ids // step)
+        if len(blocks) == 0:
+            blocks = np.zeros(min(index.nrows, 1), dtype=np.int64)
+
+    # merge runs of blocks into byte ranges, and find where each block
+    # starts in the parsed rows
+    ranges = []
+    block_begins = np.zeros(len(blocks), dtype=np.int64)
+    nparsed = 0
+    for i, block in enumerate(blocks):
+        begin, end = index.block_range(block, block)
+        if ranges and ranges[-1][1] == begin:
+            ranges[-1] = (ranges[-1][0], end)
+        else:
+            ranges.append((begin, end))
+        block_begins[i] = nparsed
+        nparsed += index.block_rows(block)
+    if not ranges:
+        ranges = [(index.data_begin, index.data_begin)]
+
+    res = _cfastcsv.parse_file(filename, sep, nthreads, flags, 0, missing_int_val,
+                               missing_float_val, _by_index(col_to_type, csv_headers),
+                               na_values=na_values, return_validity=validity is not None,
+                               narrow=narrow, decimals=_by_index(decimals, csv_headers),
+                               ranges=ranges, schema=schema)
+    res = _with_validity(res, validity)
+
+    if isinstance(row_ids, slice):
+        first = row_ids.start - blocks[0] * step if len(blocks) else 0
+        positions = slice(first, first + row_ids.stop - row_ids.start)
+    else:
+        positions = (block_begins[np.searchsorted(blocks, row_ids // step)]
+                     + row_ids % step)
+
+    return (csv_headers, [col[positions] for col in res[1]]) + tuple(res[2:])
+
+
+def take(filename, row_ids, sep=',', headers=True, nthreads=None, flags=0, col_to_type=None,
+         missing_int_val=0, missing_float_val=0.0, na_values=None, validity=None,
+         narrow='off', decimals=None):
+    """Load the data rows row_ids, in that order, parsing only the blocks
+    of rows that hold them.  The row index saved by build_index is used,
+    or made and saved if it is missing or the csv has changed.  Column
+    types are inferred from the blocks read."""
+
+    if not isinstance(filename, str):
+        raise ValueError('Invalid filename %r' % (filename,))
+    if validity == 'bitmap':
+        raise ValueError('take cannot return bitmaps')
+
+    nthreads, nheaders = _check_args(sep, headers, nthreads)
+    na_values = _check_na(na_values, validity)
+    narrow = _check_narrow(narrow)
+    decimals = _check_decimals(decimals)
+
+    index = _row_index(filename, sep, nheaders, nthreads, flags)
+    row_ids = np.array(row_ids, dtype=np.int64).ravel()
+    row_ids[row_ids < 0] += index.nrows
+    if np.any((row_ids < 0) | (row_ids >= index.nrows)):
+        raise IndexError('row out of range')
+
+    return _load_rows(filename, index, row_ids, sep, nheaders, nthreads, flags, col_to_type,
+                      missing_int_val, missing_float_val, na_values, validity, narrow, decimals)
+
+
+_AGG_OPS = ('count', 'sum', 'min', 'max', 'mean')
+
+
+def _column_name(col, csv_headers):
+    if not isinstance(col, int):
+        return col
+    if csv_headers is not None and col < len(csv_headers):
+        return csv_headers[col]
+    return str(col)
+
+
+def aggregate(filename, group_by=(), aggs=('count',), sep=',', headers=True, nthreads=None,
+              flags=0, col_to_type=None, missing_int_val=0, missing_float_val=0.0,
+              filter=None, return_stats=False, trace=None, na_values=None):
+    """Aggregate the csv, grouped by the group_by columns, without loading it.
+
+    aggs is a list of (op, column), where op is count, sum, min, max or
+    mean, and 'count' on its own counts rows.  Empty and NA cells are
+    skipped, so ('count', column) counts the cells that are not null.
+    Returns the headers and columns of the result: the group keys, in
+    order of first appearance, then the aggregates."""
+
+    if not isinstance(filename, str):
+        raise ValueError('Invalid filename %r' % (filename,))
+
+    if isinstance(group_by, (str, bytes, int)):
+        group_by = [group_by]
+    group_by = list(group_by)
+
+    agg_specs = []
+    for agg in aggs:
+        if isinstance(agg, str):
+            agg = (agg, None)
+        op, col = agg
+        if op not in _AGG_OPS or (col is None and op != 'count'):
+            raise ValueError('Invalid aggregate %r' % (agg,))
+        agg_specs.append((op, col))
+
     nthreads, nheaders = _check_args(sep, headers, nthreads)
+    if filter is not None:
+        filter = _filter.normalize(filter)
+    na_values = _check_na(na_values, None)
 
-    return _cfastcsv.parse_csv(s, sep, nthreads, flags,
+    res = _cfastcsv.parse_file(filename, sep, nthreads, flags,
                                nheaders, missing_int_val, missing_float_val,
-                               col_to_type)
+                               col_to_type, return_stats=return_stats, trace=trace,
+                               filter=filter, na_values=na_values,
+                               group_by=[_filter.column(col) for col in group_by],
+                               aggs=[(op, None if col is None else _filter.column(col))
+                                     for op, col in agg_specs])
+
+    csv_headers = res[0]
+    out_headers = [_column_name(col, csv_headers) for col in group_by]
+    for op, col in agg_specs:
+        if col is None:
+            out_headers.append(op)
+        else:
+            out_headers.append('%s(%s)' % (op, _column_name(col, csv_headers)))
+
+    return (out_headers,) + tuple(res[1:])
+
+
+def _pack_validity(valid):
+    """Arrow style bitmap, the inverse of the unpacking in _with_validity."""
+
+    bits = np.zeros((len(valid) + 7) // 8 * 8, dtype=np.uint8)
+    bits[:len(valid)] = valid
+    return np.packbits(bits.reshape(-1, 8)[:, ::-1], axis=1).ravel()
+
+
+def _dump_column(col):
+    """The column as an array the writer takes, and its validity bitmap."""
+
+    validity = None
+    if isinstance(col, np.ma.MaskedArray):
+        mask = np.ma.getmaskarray(col)
+        if mask.any():
+            validity = _pack_validity(~mask)
+        col = col.data
+
+    col = np.asarray(col)
+    if col.ndim != 1:
+        raise ValueError('Columns must be 1-d')
+    if not col.dtype.isnative:
+        col = col.astype(col.dtype.newbyteorder('='))
+
+    kind = col.dtype.kind
+    if kind == 'b':
+        col = col.astype(np.int8)
+    elif kind == 'u':
+        if col.dtype.itemsize == 8 and len(col) > 0 and col.max() >= 2 ** 63:
+            raise TypeError('Cannot write uint64 values over 2 ** 63 - 1')
+        col = col.astype(np.int64 if col.dtype.itemsize >= 4 else np.int32)
+    elif kind == 'f' and col.dtype.itemsize < 4:
+        col = col.astype(np.float32)
+    elif kind == 'U':
+        col = np.char.encode(col, 'utf8')
+    elif kind == 'O':
+        col = np.array([b'' if v is None else v if isinstance(v, bytes)
+                        else (u'%s' % (v,)).encode('utf8') for v in col], dtype=bytes)
+
+    return np.ascontiguousarray(col), validity
+
+
+def dump(filename, headers, columns, sep=',', nthreads=None):
+    """Write columns (as returned by load) to a csv file.  headers may be
+    None for no header line.  Masked values of numpy masked arrays are
+    written as empty cells.  Floats are written with the fewest digits
+    that read back the same."""
+
+    if not isinstance(filename, str):
+        raise ValueError('Invalid filename %r' % (filename,))
+    nthreads, _ = _check_args(sep, headers, nthreads)
+
+    columns = [_dump_column(col) for col in columns]
+    if headers is not None:
+        headers = [h if isinstance(h, bytes) else h.encode('utf8') for h in headers]
+
+    _cfastcsv.write_file(filename, [col for col, _ in columns], headers,
+                         [validity for _, validity in columns], sep=sep, nthreads=nthreads)
+
+
+def _frame_blocks(columns):
+    """(2-d array, column indexes) for each pandas block.  Numeric columns
+    loaded with blocks=True are rows of one array per dtype already."""
+
+    blocks = []
+    block_idxs = {}
+    strs = []
+    for i, col in enumerate(columns):
+        if col.dtype.kind == 'S':
+            strs.append(i)
+            continue
+        base = col.base
+        if base is None or base.ndim != 2:
+            blocks.append((col.reshape(1, -1), [i]))
+            continue
+        if id(base) not in block_idxs:
+            block_idxs[id(base)] = len(blocks)
+            blocks.append((base, []))
+        blocks[block_idxs[id(base)]][1].append(i)
+
+    if strs:
+        arr = np.empty((len(strs), len(columns[strs[0]])), dtype=object)
+        for row, i in enumerate(strs):
+            arr[row] = np.char.decode(columns[i], 'utf8')
+        blocks.append((arr, strs))
+
+    return [(arr, np.array(idxs, dtype=np.intp)) for arr, idxs in blocks]
+
+
+def read_frame(filename, sep=',', headers=True, nthreads=None, flags=0, col_to_type=None,
+               missing_int_val=0, missing_float_val=0.0, filter=None, na_values=None,
+               narrow='off'):
+    """Load a csv file as a pandas DataFrame.  Numeric columns of the same
+    dtype are filled in place in one 2-d array, which becomes the pandas
+    block as it is, so nothing is copied.  String columns are decoded to
+    str objects."""
+
+    import pandas as pd
+
+    if not isinstance(filename, str):
+        raise ValueError('Invalid filename %r' % (filename,))
+
+    nthreads, nheaders = _check_args(sep, headers, nthreads)
+    if filter is not None:
+        filter = _filter.normalize(filter)
+    na_values = _check_na(na_values, None)
+    narrow = _check_narrow(narrow)
+
+    res = _cfastcsv.parse_file(filename, sep, nthreads, flags,
+                               nheaders, missing_int_val, missing_float_val,
+                               col_to_type, filter=filter, na_values=na_values,
+                               narrow=narrow, blocks=True)
+
+    csv_headers, columns = res
+    nrows = len(columns[0]) if columns else 0
+    if csv_headers is None:
+        csv_headers = range(len(columns))
+    csv_headers = list(csv_headers)[:len(columns)]
+    csv_headers += [str(i) for i in range(len(csv_headers), len(columns))]
+
+    index = pd.RangeIndex(nrows)
+    try:
+        from pandas.api.internals import create_dataframe_from_blocks
+    except ImportError:
+        # one block per column, which pandas 2 keeps with no copy, but
+        # pandas 1 consolidates into a copy with one block per dtype
+        return pd.DataFrame(dict(zip(csv_headers, columns)), columns=csv_headers,
+                            index=index, copy=False)
+
+    return create_dataframe_from_blocks(_frame_blocks(columns), index=index,
+                                        columns=pd.Index(csv_headers))
+
+
+def _row_ends(data):
+    """Offsets just past the complete rows in data, which begins outside
+    quotes.  Quotes are assumed to be balanced in each row."""
+
+    buf = np.frombuffer(data, dtype=np.uint8)
+    newlines = np.flatnonzero(buf == ord('\n'))
+    in_quotes = np.bitwise_xor.accumulate((buf == ord('"')).astype(np.uint8))
+    return newlines[in_quotes[newlines] == 0] + 1
+
+
+def _promote(old, new):
+    """The dtype for a column with old and new rows, or None if the old
+    rows have to be parsed again."""
+
+    if old == new:
+        return old
+    if old.kind == new.kind and old.kind in 'iS':
+        return max(old, new, key=lambda dtype: dtype.itemsize)
+    if old.kind == 'f' and new.kind in 'if':
+        return old
+    if old.kind == 'S':
+        return old
+    return None
+
+
+class Tail(object):
+    """Follows a csv file that other processes append to.  Each refresh
+    parses only the complete rows added since the last one, in parallel,
+    and appends them to the columns, promoting types if the new rows need
+    it.  The columns grow by doubling, so a refresh costs about as much as
+    the new rows."""
+
+    def __init__(self, filename, sep=',', headers=True, nthreads=None, flags=0,
+                 col_to_type=None, missing_int_val=0, missing_float_val=0.0, na_values=None):
+        if not isinstance(filename, str):
+            raise ValueError('Invalid filename %r' % (filename,))
+        self.filename = filename
+        self._nthreads, self._nheaders = _check_args(sep, headers, nthreads)
+        self._sep = sep
+        self._flags = flags
+        self._col_to_type = col_to_type
+        self._missing_int_val = missing_int_val
+        self._missing_float_val = missing_float_val
+        self._na_values = _check_na(na_values, None)
+        self.headers = None
+        self._data_begin = None  # after the header line
+        self._end = 0  # of the complete rows parsed
+        self._bufs = []
+        self._nrows = 0
+
+    def __len__(self):
+        return self._nrows
+
+    @property
+    def columns(self):
+        return [buf[:self._nrows] for buf in self._bufs]
+
+    def _parse(self, begin, end, col_to_type=None):
+        types = dict(_by_index(self._col_to_type, self.headers) or {})
+        types.update(col_to_type or {})
+        return _cfastcsv.parse_file(self.filename, self._sep, self._nthreads, self._flags, 0,
+                                    self._missing_int_val, self._missing_float_val,
+                                    types or None, na_values=self._na_values,
+                                    ranges=[(begin, end)])[1]
+
+    def _missing(self, dtype, nrows):
+        if dtype.kind == 'S':
+            return np.zeros(nrows, dtype=dtype)
+        if dtype.kind == 'f':
+            return np.full(nrows, self._missing_float_val, dtype=dtype)
+        return np.full(nrows, self._missing_int_val, dtype=dtype)
+
+    def _reload(self, end):
+        self._bufs = self._parse(self._data_begin, end)
+        self._nrows = len(self._bufs[0]) if self._bufs else 0
+        self._end = end
+        return self.columns
+
+    def _append(self, delta):
+        nrows = self._nrows + len(delta[0])
+        for i, col in enumerate(delta):
+            buf = self._bufs[i]
+            if col.dtype != buf.dtype:
+                buf = buf.astype(col.dtype)
+            if nrows > len(buf):
+                grown = np.empty(max(nrows, 2 * len(buf)), dtype=buf.dtype)
+                grown[:self._nrows] = buf[:self._nrows]
+                buf = grown
+            buf[self._nrows:nrows] = col
+            self._bufs[i] = buf
+        self._nrows = nrows
+
+    def refresh(self):
+        """Parse the rows appended since the last refresh, and return them
+        as columns.  Reloads the whole file if it has shrunk, or if the
+        earlier rows would have different types."""
+
+        size = os.path.getsize(self.filename)
+        if size < self._end:
+            self.headers = None
+            self._data_begin = None
+            self._end = 0
+            self._bufs = []
+            self._nrows = 0
+
+        with io.open(self.filename, 'rb') as fp:
+            fp.seek(self._end)
+            data = fp.read(size - self._end)
+
+        if self._data_begin is None:
+            header_end = 0
+            if self._nheaders:
+                ends = _row_ends(data)
+                if len(ends) == 0:
+                    return []
+                header_end = int(ends[0])
+                self.headers = _cfastcsv.parse_file(self.filename, self._sep, 1, self._flags,
+                                                    self._nheaders, ranges=[(0, header_end)])[0]
+                data = data[header_end:]
+            self._data_begin = self._end = header_end
+
+        ends = _row_ends(data)
+        end = self._end + (int(ends[-1]) if len(ends) else 0)
+        if end == self._end:
+            return [buf[:0] for buf in self._bufs]
+        if not self._bufs:
+            return self._reload(end)
+
+        delta = self._parse(self._end, end)
+        if len(delta) > len(self._bufs):
+            ndelta = len(delta[0])
+            return [col[-ndelta:] for col in self._reload(end)]
+        for i in range(len(delta), len(self._bufs)):
+            delta.append(self._missing(self._bufs[i].dtype, len(delta[0])))
+
+        dtypes = [_promote(buf.dtype, col.dtype) for buf, col in zip(self._bufs, delta)]
+        if None in dtypes:
+            ndelta = len(delta[0])
+            return [col[-ndelta:] for col in self._reload(end)]
+
+        # parse again the new columns that have to be floats or strings
+        types = dict((i, float if dtype.kind == 'f' else str)
+                     for i, (dtype, col) in enumerate(zip(dtypes, delta))
+                     if dtype.kind in 'fS' and col.dtype.kind != dtype.kind)
+        if types:
+            delta2 = self._parse(self._end, end, types)
+            for i in types:
+                delta[i] = delta2[i]
+                dtypes[i] = _promote(self._bufs[i].dtype, delta[i].dtype)
+
+        delta = [col.astype(dtype) if col.dtype != dtype else col
+                 for col, dtype in zip(delta, dtypes)]
+        self._append(delta)
+        self._end = end
+
+        return delta
+
+
+class Table(object):
+    """A csv file from open.  Indexing by header or column number fills
+    that column, on the parse threads, the first time."""
+
+    def __init__(self, headers, table, nrows, ncols):
+        self.headers = headers
+        self._table = table
+        self._nrows = nrows
+        self._ncols = ncols
+        self._columns = {}
+
+    def __len__(self):
+        return self._nrows
+
+    def _col_idx(self, col):
+        if isinstance(col, int):
+            col_idx = col + self._ncols if col < 0 else col
+            if not 0 <= col_idx < self._ncols:
+                raise IndexError('no column %d' % col)
+            return col_idx
+        if self.headers is not None and col in self.headers:
+            col_idx = self.headers.index(col)
+            if col_idx < self._ncols:
+                return col_idx
+        raise KeyError(col)
+
+    def __getitem__(self, col):
+        col_idx = self._col_idx(col)
+        arr = self._columns.get(col_idx)
+        if arr is None:
+            if self._table is None:
+                raise ValueError('table is closed')
+            arr = _cfastcsv.fill_column(self._table, col_idx)
+            self._columns[col_idx] = arr
+        return arr
+
+    def close(self):
+        """Unmap the file.  Columns already filled are kept."""
+
+        self._table = None
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *args):
+        self.close()
+
+
+def open(filename, sep=',', headers=True, nthreads=None, flags=0, col_to_type=None,
+         missing_int_val=0, missing_float_val=0.0, na_values=None, narrow='off'):
+    """Find the rows and column types of a csv file without filling any
+    columns, which costs about as much as stage 1 of load.  Columns of the
+    Table are then filled as they are used, and are the same as load
+    would give."""
+
+    if not isinstance(filename, str):
+        raise ValueError('Invalid filename %r' % (filename,))
+
+    nthreads, nheaders = _check_args(sep, headers, nthreads)
+    na_values = _check_na(na_values, None)
+    narrow = _check_narrow(narrow)
+
+    csv_headers, table, nrows, ncols = _cfastcsv.open_file(
+        filename, sep, nthreads, flags, nheaders, missing_int_val, missing_float_val,
+        col_to_type, na_values=na_values, narrow=narrow)
+
+    return Table(csv_headers, table, nrows, ncols)
+
+
+def scan(filename, sep=',', headers=True, nthreads=None, flags=0, col_to_type=None,
+         na_values=None, narrow='off'):
+    """Find the shape and column types of a csv file without filling any
+    columns, which costs about as much as stage 1 of load.  Returns a
+    dict of headers, nrows, ncols, dtypes (as load would give), widths
+    (of the widest cell), quoted (cells in quotes per column), and
+    fixup_bytes and nchunks_reparsed (from chunks that began inside
+    quotes)."""
+
+    if not isinstance(filename, str):
+        raise ValueError('Invalid filename %r' % (filename,))
+
+    nthreads, nheaders = _check_args(sep, headers, nthreads)
+    na_values = _check_na(na_values, None)
+    narrow = _check_narrow(narrow)
+
+    csv_headers, table, nrows, ncols = _cfastcsv.open_file(
+        filename, sep, nthreads, flags, nheaders, 0, 0.0, col_to_type,
+        na_values=na_values, narrow=narrow)
+    descrs, widths, quoted, fixup_bytes, nchunks_reparsed = _cfastcsv.table_info(table)
+    del table  # unmaps the file
+
+    dtypes = [np.dtype('S%d' % width) if descr.char == 'S' else descr
+              for descr, width in zip(descrs, widths)]
+
+    return {'headers': csv_headers, 'nrows': nrows, 'ncols': ncols, 'dtypes': dtypes,
+            'widths': widths, 'quoted': quoted, 'fixup_bytes': fixup_bytes,
+            'nchunks_reparsed': nchunks_reparsed}
@@ -0,0 +1,84 @@
+# Copyright 2026 Ben Walsh
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# A filter is a nested tuple:
+#
+#   ('and', f1, f2, ...)     ('or', f1, f2, ...)
+#   (op, col, value)         op is one of == != < <= > >=
+#   ('in', col, values)
+#   ('between', col, lo, hi) lo <= col <= hi
+#
+# col is a header name or a column index.  Values are compared with the
+# column as it is loaded, so numeric columns need numbers and string
+# columns need strings.
+#
+# normalize() turns this into the form _cfastcsv expects, with names and
+# strings as utf8 bytes and values always in a list.
+
+import numbers
+
+_COMPARISONS = ('==', '!=', '<', '<=', '>', '>=')
+
+
+def _to_bytes(s):
+    if isinstance(s, bytes):
+        return s
+    return s.encode('utf8')
+
+
+def column(col):
+    if isinstance(col, numbers.Integral) and not isinstance(col, bool):
+        if col < 0:
+            raise ValueError('Invalid filter column %r' % (col,))
+        return int(col)
+    if isinstance(col, (bytes, type(u''))):
+        return _to_bytes(col)
+    raise ValueError('Invalid filter column %r' % (col,))
+
+
+def _value(val):
+    if isinstance(val, (bytes, type(u''))):
+        return _to_bytes(val)
+    if isinstance(val, numbers.Integral):
+        return int(val)
+    if isinstance(val, numbers.Real):
+        return float(val)
+    raise ValueError('Invalid filter value %r' % (val,))
+
+
+def normalize(spec):
+    if not isinstance(spec, tuple) or not spec:
+        raise ValueError('Invalid filter %r' % (spec,))
+
+    op = spec[0]
+    if op in ('and', 'or'):
+        if len(spec) < 2:
+            raise ValueError('Invalid filter %r' % (spec,))
+        return (op, [normalize(s) for s in spec[1:]])
+    if op in _COMPARISONS:
+        if len(spec) != 3:
+            raise ValueError('Invalid filter %r' % (spec,))
+        return (op, column(spec[1]), [_value(spec[2])])
+    if op == 'in':
+        if len(spec) != 3 or isinstance(spec[2], (bytes, type(u''))):
+            raise ValueError('Invalid filter %r' % (spec,))
+        return (op, column(spec[1]), [_value(v) for v in spec[2]])
+    if op == 'between':
+        if len(spec) != 4:
+            raise ValueError('Invalid filter %r' % (spec,))
+        col = column(spec[1])
+        return ('and', [('>=', col, [_value(spec[2])]),
+                        ('<=', col, [_value(spec[3])])])
+
+    raise ValueError('Invalid filter op %r' % (op,))
@@ -72,6 +72,9 @@ test_parse_csv(const uchar *csv_buf, size_t buf_len, uchar sep, int nthreads,
     result->r.add_header = &test_add_header;
     result->r.add_column = &test_add_column;
     result->r.fix_column_type = NULL;
+    result->r.add_validity = NULL;
+    result->r.fix_decimal_scale = NULL;
+    result->r.add_mapped_column = NULL;
 
     parse_csv(&input, (FastCsvResult *)result);
 
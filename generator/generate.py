@@ -52,6 +52,9 @@ def main():
                            '--label-prefix=inquotes',
                            '--outfilename=parser2_inquotes.h'])
 
+    with open('fill_kernels.h', 'w') as fp:
+        subprocess.check_call([_PYTHON, os.path.join(_MYDIR, 'kernels.py')], stdout=fp)
+
     return 0
 
 
@@ -0,0 +1,235 @@
+#!/usr/bin/env python
+#
+# Copyright 2026 Ben Walsh
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Writes fill_arrays kernels for numeric schemas whose column types
+# repeat a short pattern, 'i' for int64 and 'd' for double.  Each
+# kernel has a copy of the cell parser per position in the pattern, so
+# the column type is known without looking at the column.
+
+import sys
+
+_PATTERNS = ['i', 'd', 'id', 'di']
+
+_CELL = '''\
+ %(label)s_cell:
+    cell = p;
+    cellp = p;
+    nquotes = 0;
+    value = 0;
+    expo = 0;
+    fracexpo = 0;
+    exposign = 1;
+
+    if (p >= buf_end) {  /* empty last cell */
+        c = 0;
+        goto %(label)s_goodend;
+    }
+
+    c = *p;
+
+#define goodend %(label)s_goodend
+#define badend %(label)s_badend
+#define bad %(label)s_bad
+
+    if (c == '"') {
+        ++nquotes;
+        ++cellp;
+        NEXTCHAR2_INQUOTES(goodend);
+
+#include "parser2_inquotes.h"
+
+    } else {
+
+#include "parser2.h"
+
+    }
+
+    if (nquotes != 1) {  /* c not in quotes */
+        if (c == '\\r') {
+            NEXTCHAR_NOQUOTES(goodend);
+        }
+
+        if (c == sep || c == '\\n') {
+            goto goodend;
+        }
+    }
+
+#undef goodend
+#undef badend
+#undef bad
+
+ %(label)s_bad:
+    p = skip_cell(cell, buf_end, sep);
+    if (p < buf_end) {
+        c = *p;
+    }
+
+ %(label)s_badend:
+    cellp = p;
+
+ %(label)s_goodend:
+%(store)s
+    if (p >= buf_end || c == '\\n') {
+        goto rowend;
+    }
+    if (++col_idx == ncols) {
+        goto rowextra;
+    }
+    p++;
+    goto %(next_label)s_cell;
+
+'''
+
+_STORE_INT = '''\
+    *(int64_t *)cols[col_idx] = (p == cellp || fracexpo != 0)
+        ? common->missing_int_val : value;
+    cols[col_idx] += sizeof(int64_t);
+'''
+
+_STORE_DOUBLE = '''\
+    val = (p == cellp) ? common->missing_float_val
+        : parsed_double(value, expo, fracexpo, exposign, 0);
+    *(double *)cols[col_idx] = val;
+    cols[col_idx] += sizeof(double);
+'''
+
+_MISSING_INT = '''\
+        *(int64_t *)cols[col_idx] = common->missing_int_val;
+        cols[col_idx] += sizeof(int64_t);
+'''
+
+_MISSING_DOUBLE = '''\
+        *(double *)cols[col_idx] = common->missing_float_val;
+        cols[col_idx] += sizeof(double);
+'''
+
+_MISSING_MIXED = '''\
+        if (CHUNK_COLUMN(chunk, col_idx).type == COL_TYPE_DOUBLE) {
+            *(double *)cols[col_idx] = common->missing_float_val;
+            cols[col_idx] += sizeof(double);
+        } else {
+            *(int64_t *)cols[col_idx] = common->missing_int_val;
+            cols[col_idx] += sizeof(int64_t);
+        }
+'''
+
+_KERNEL_BEGIN = '''\
+static int
+fill_kernel_%(pattern)s(ThreadCommon *common, Chunk *chunk)
+{
+    const uchar *p;
+    const uchar *buf_end;
+    const uchar *cell;
+    const uchar *cellp;
+    int ncols = chunk->ncols;
+    int col_idx;
+    int row_idx;
+    int nquotes;
+    uchar c;
+    uchar **cols;  /* where the next cell of each column goes */
+%(double_decls)s    int digit;
+    int64_t value;
+    int expo;
+    int fracexpo;
+    int exposign;
+    const uchar sep = common->sep;
+
+    if (chunk->nrows == 0) {
+        return 0;
+    }
+
+    cols = (uchar **)malloc(ncols * sizeof(uchar *));
+    for (col_idx = 0; col_idx < ncols; col_idx++) {
+        cols[col_idx] = CHUNK_COLUMN(chunk, col_idx).arr_ptr;
+    }
+
+    buf_end = chunk->buf_end;
+    p = chunk->buf;
+    col_idx = 0;
+    row_idx = 0;
+%(int_only)s
+'''
+
+_KERNEL_END = '''\
+ rowextra:
+    /* more cells than the schema has columns */
+    p = find_row_end(p + 1, buf_end, sep);
+
+ rowend:
+    for (col_idx++; col_idx < ncols; col_idx++) {
+%(missing)s\
+    }
+    col_idx = 0;
+    row_idx++;
+    p++;
+    if (row_idx < chunk->nrows) {
+        goto %(first_label)s_cell;
+    }
+
+    if (common->stats != NULL) {
+        CHUNK_STATS(common, chunk)->nbytes = p - chunk->buf;
+        CHUNK_STATS(common, chunk)->nrows = chunk->nrows;
+    }
+
+    free(cols);
+
+    return 0;
+}
+
+'''
+
+
+def _kernel(pattern):
+    n = len(pattern)
+    labels = ['%s%d' % (t, i) for i, t in enumerate(pattern)]
+    if pattern == 'i' * n:
+        missing = _MISSING_INT
+    elif pattern == 'd' * n:
+        missing = _MISSING_DOUBLE
+    else:
+        missing = _MISSING_MIXED
+
+    if 'd' in pattern:
+        double_decls = '    double val;\n'
+        int_only = ''
+    else:
+        double_decls = ''
+        int_only = '    (void)exposign;  /* parsed, but int64 cells have no exponent */\n'
+
+    sys.stdout.write(_KERNEL_BEGIN % {'pattern': pattern, 'double_decls': double_decls,
+                                      'int_only': int_only})
+    for i, t in enumerate(pattern):
+        sys.stdout.write(_CELL % {'label': labels[i],
+                                  'next_label': labels[(i + 1) % n],
+                                  'store': _STORE_INT if t == 'i' else _STORE_DOUBLE})
+    sys.stdout.write(_KERNEL_END % {'missing': missing, 'first_label': labels[0]})
+
+
+def main():
+    for pattern in _PATTERNS:
+        _kernel(pattern)
+
+    sys.stdout.write('static const FillKernel fill_kernels[] = {\n')
+    for pattern in _PATTERNS:
+        sys.stdout.write('    {"%s", fill_kernel_%s},\n' % (pattern, pattern))
+    sys.stdout.write('    {NULL, NULL}\n')
+    sys.stdout.write('};\n')
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
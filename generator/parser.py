@@ -284,12 +284,12 @@ def main():
     dot = SingleChar("c == '.'", t(change_to_double))
 
     pl_digit = SingleChar("(digit = c ^ '0') <= 9", p("value = value * 10 + digit;"))
-    pl_frac_digit = SingleChar("(digit = c ^ '0') <= 9", p("value = value * 10 + digit; ++fracexpo;"))
+    pl_frac_digit = SingleChar("(digit = c ^ '0') <= 9", tp("++frac_digits;", "value = value * 10 + digit; ++fracexpo;"))
     mi_digit = SingleChar("(digit = c ^ '0') <= 9", p("value = value * 10 - digit;"))
-    mi_frac_digit = SingleChar("(digit = c ^ '0') <= 9", p("value = value * 10 - digit; ++fracexpo;"))
+    mi_frac_digit = SingleChar("(digit = c ^ '0') <= 9", tp("++frac_digits;", "value = value * 10 - digit; ++fracexpo;"))
     if args.type_stage:
         pl_int_digits = Multiple(SingleChar("(digit = c ^ '0') <= 9", ""))
-        pl_frac_digits = pl_int_digits
+        pl_frac_digits = Multiple(SingleChar("(digit = c ^ '0') <= 9", "++frac_digits;"))
         mi_int_digits = pl_int_digits
         mi_frac_digits = pl_frac_digits
     else:
@@ -318,7 +318,7 @@ def main():
 
     expo_digit = SingleChar("(digit = c ^ '0') <= 9", p("expo = (expo * 10 + digit) & 511;"))
 
-    expo = _seq(SingleChar("(c | 32) == 'e'", t(change_to_double)),
+    expo = _seq(SingleChar("(c | 32) == 'e'", t(change_to_double + " columns[col_idx].has_expo = 1;")),
                 expo_plus_or_minus,
                 expo_digit,
                 Multiple(expo_digit))
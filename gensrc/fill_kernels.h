@@ -0,0 +1,684 @@
+static int
+fill_kernel_i(ThreadCommon *common, Chunk *chunk)
+{
+    const uchar *p;
+    const uchar *buf_end;
+    const uchar *cell;
+    const uchar *cellp;
+    int ncols = chunk->ncols;
+    int col_idx;
+    int row_idx;
+    int nquotes;
+    uchar c;
+    uchar **cols;  /* where the next cell of each column goes */
+    int digit;
+    int64_t value;
+    int expo;
+    int fracexpo;
+    int exposign;
+    const uchar sep = common->sep;
+
+    if (chunk->nrows == 0) {
+        return 0;
+    }
+
+    cols = (uchar **)malloc(ncols * sizeof(uchar *));
+    for (col_idx = 0; col_idx < ncols; col_idx++) {
+        cols[col_idx] = CHUNK_COLUMN(chunk, col_idx).arr_ptr;
+    }
+
+    buf_end = chunk->buf_end;
+    p = chunk->buf;
+    col_idx = 0;
+    row_idx = 0;
+    (void)exposign;  /* parsed, but int64 cells have no exponent */
+
+ i0_cell:
+    cell = p;
+    cellp = p;
+    nquotes = 0;
+    value = 0;
+    expo = 0;
+    fracexpo = 0;
+    exposign = 1;
+
+    if (p >= buf_end) {  /* empty last cell */
+        c = 0;
+        goto i0_goodend;
+    }
+
+    c = *p;
+
+#define goodend i0_goodend
+#define badend i0_badend
+#define bad i0_bad
+
+    if (c == '"') {
+        ++nquotes;
+        ++cellp;
+        NEXTCHAR2_INQUOTES(goodend);
+
+#include "parser2_inquotes.h"
+
+    } else {
+
+#include "parser2.h"
+
+    }
+
+    if (nquotes != 1) {  /* c not in quotes */
+        if (c == '\r') {
+            NEXTCHAR_NOQUOTES(goodend);
+        }
+
+        if (c == sep || c == '\n') {
+            goto goodend;
+        }
+    }
+
+#undef goodend
+#undef badend
+#undef bad
+
+ i0_bad:
+    p = skip_cell(cell, buf_end, sep);
+    if (p < buf_end) {
+        c = *p;
+    }
+
+ i0_badend:
+    cellp = p;
+
+ i0_goodend:
+    *(int64_t *)cols[col_idx] = (p == cellp || fracexpo != 0)
+        ? common->missing_int_val : value;
+    cols[col_idx] += sizeof(int64_t);
+
+    if (p >= buf_end || c == '\n') {
+        goto rowend;
+    }
+    if (++col_idx == ncols) {
+        goto rowextra;
+    }
+    p++;
+    goto i0_cell;
+
+ rowextra:
+    /* more cells than the schema has columns */
+    p = find_row_end(p + 1, buf_end, sep);
+
+ rowend:
+    for (col_idx++; col_idx < ncols; col_idx++) {
+        *(int64_t *)cols[col_idx] = common->missing_int_val;
+        cols[col_idx] += sizeof(int64_t);
+    }
+    col_idx = 0;
+    row_idx++;
+    p++;
+    if (row_idx < chunk->nrows) {
+        goto i0_cell;
+    }
+
+    if (common->stats != NULL) {
+        CHUNK_STATS(common, chunk)->nbytes = p - chunk->buf;
+        CHUNK_STATS(common, chunk)->nrows = chunk->nrows;
+    }
+
+    free(cols);
+
+    return 0;
+}
+
+static int
+fill_kernel_d(ThreadCommon *common, Chunk *chunk)
+{
+    const uchar *p;
+    const uchar *buf_end;
+    const uchar *cell;
+    const uchar *cellp;
+    int ncols = chunk->ncols;
+    int col_idx;
+    int row_idx;
+    int nquotes;
+    uchar c;
+    uchar **cols;  /* where the next cell of each column goes */
+    double val;
+    int digit;
+    int64_t value;
+    int expo;
+    int fracexpo;
+    int exposign;
+    const uchar sep = common->sep;
+
+    if (chunk->nrows == 0) {
+        return 0;
+    }
+
+    cols = (uchar **)malloc(ncols * sizeof(uchar *));
+    for (col_idx = 0; col_idx < ncols; col_idx++) {
+        cols[col_idx] = CHUNK_COLUMN(chunk, col_idx).arr_ptr;
+    }
+
+    buf_end = chunk->buf_end;
+    p = chunk->buf;
+    col_idx = 0;
+    row_idx = 0;
+
+ d0_cell:
+    cell = p;
+    cellp = p;
+    nquotes = 0;
+    value = 0;
+    expo = 0;
+    fracexpo = 0;
+    exposign = 1;
+
+    if (p >= buf_end) {  /* empty last cell */
+        c = 0;
+        goto d0_goodend;
+    }
+
+    c = *p;
+
+#define goodend d0_goodend
+#define badend d0_badend
+#define bad d0_bad
+
+    if (c == '"') {
+        ++nquotes;
+        ++cellp;
+        NEXTCHAR2_INQUOTES(goodend);
+
+#include "parser2_inquotes.h"
+
+    } else {
+
+#include "parser2.h"
+
+    }
+
+    if (nquotes != 1) {  /* c not in quotes */
+        if (c == '\r') {
+            NEXTCHAR_NOQUOTES(goodend);
+        }
+
+        if (c == sep || c == '\n') {
+            goto goodend;
+        }
+    }
+
+#undef goodend
+#undef badend
+#undef bad
+
+ d0_bad:
+    p = skip_cell(cell, buf_end, sep);
+    if (p < buf_end) {
+        c = *p;
+    }
+
+ d0_badend:
+    cellp = p;
+
+ d0_goodend:
+    val = (p == cellp) ? common->missing_float_val
+        : parsed_double(value, expo, fracexpo, exposign, 0);
+    *(double *)cols[col_idx] = val;
+    cols[col_idx] += sizeof(double);
+
+    if (p >= buf_end || c == '\n') {
+        goto rowend;
+    }
+    if (++col_idx == ncols) {
+        goto rowextra;
+    }
+    p++;
+    goto d0_cell;
+
+ rowextra:
+    /* more cells than the schema has columns */
+    p = find_row_end(p + 1, buf_end, sep);
+
+ rowend:
+    for (col_idx++; col_idx < ncols; col_idx++) {
+        *(double *)cols[col_idx] = common->missing_float_val;
+        cols[col_idx] += sizeof(double);
+    }
+    col_idx = 0;
+    row_idx++;
+    p++;
+    if (row_idx < chunk->nrows) {
+        goto d0_cell;
+    }
+
+    if (common->stats != NULL) {
+        CHUNK_STATS(common, chunk)->nbytes = p - chunk->buf;
+        CHUNK_STATS(common, chunk)->nrows = chunk->nrows;
+    }
+
+    free(cols);
+
+    return 0;
+}
+
+static int
+fill_kernel_id(ThreadCommon *common, Chunk *chunk)
+{
+    const uchar *p;
+    const uchar *buf_end;
+    const uchar *cell;
+    const uchar *cellp;
+    int ncols = chunk->ncols;
+    int col_idx;
+    int row_idx;
+    int nquotes;
+    uchar c;
+    uchar **cols;  /* where the next cell of each column goes */
+    double val;
+    int digit;
+    int64_t value;
+    int expo;
+    int fracexpo;
+    int exposign;
+    const uchar sep = common->sep;
+
+    if (chunk->nrows == 0) {
+        return 0;
+    }
+
+    cols = (uchar **)malloc(ncols * sizeof(uchar *));
+    for (col_idx = 0; col_idx < ncols; col_idx++) {
+        cols[col_idx] = CHUNK_COLUMN(chunk, col_idx).arr_ptr;
+    }
+
+    buf_end = chunk->buf_end;
+    p = chunk->buf;
+    col_idx = 0;
+    row_idx = 0;
+
+ i0_cell:
+    cell = p;
+    cellp = p;
+    nquotes = 0;
+    value = 0;
+    expo = 0;
+    fracexpo = 0;
+    exposign = 1;
+
+    if (p >= buf_end) {  /* empty last cell */
+        c = 0;
+        goto i0_goodend;
+    }
+
+    c = *p;
+
+#define goodend i0_goodend
+#define badend i0_badend
+#define bad i0_bad
+
+    if (c == '"') {
+        ++nquotes;
+        ++cellp;
+        NEXTCHAR2_INQUOTES(goodend);
+
+#include "parser2_inquotes.h"
+
+    } else {
+
+#include "parser2.h"
+
+    }
+
+    if (nquotes != 1) {  /* c not in quotes */
+        if (c == '\r') {
+            NEXTCHAR_NOQUOTES(goodend);
+        }
+
+        if (c == sep || c == '\n') {
+            goto goodend;
+        }
+    }
+
+#undef goodend
+#undef badend
+#undef bad
+
+ i0_bad:
+    p = skip_cell(cell, buf_end, sep);
+    if (p < buf_end) {
+        c = *p;
+    }
+
+ i0_badend:
+    cellp = p;
+
+ i0_goodend:
+    *(int64_t *)cols[col_idx] = (p == cellp || fracexpo != 0)
+        ? common->missing_int_val : value;
+    cols[col_idx] += sizeof(int64_t);
+
+    if (p >= buf_end || c == '\n') {
+        goto rowend;
+    }
+    if (++col_idx == ncols) {
+        goto rowextra;
+    }
+    p++;
+    goto d1_cell;
+
+ d1_cell:
+    cell = p;
+    cellp = p;
+    nquotes = 0;
+    value = 0;
+    expo = 0;
+    fracexpo = 0;
+    exposign = 1;
+
+    if (p >= buf_end) {  /* empty last cell */
+        c = 0;
+        goto d1_goodend;
+    }
+
+    c = *p;
+
+#define goodend d1_goodend
+#define badend d1_badend
+#define bad d1_bad
+
+    if (c == '"') {
+        ++nquotes;
+        ++cellp;
+        NEXTCHAR2_INQUOTES(goodend);
+
+#include "parser2_inquotes.h"
+
+    } else {
+
+#include "parser2.h"
+
+    }
+
+    if (nquotes != 1) {  /* c not in quotes */
+        if (c == '\r') {
+            NEXTCHAR_NOQUOTES(goodend);
+        }
+
+        if (c == sep || c == '\n') {
+            goto goodend;
+        }
+    }
+
+#undef goodend
+#undef badend
+#undef bad
+
+ d1_bad:
+    p = skip_cell(cell, buf_end, sep);
+    if (p < buf_end) {
+        c = *p;
+    }
+
+ d1_badend:
+    cellp = p;
+
+ d1_goodend:
+    val = (p == cellp) ? common->missing_float_val
+        : parsed_double(value, expo, fracexpo, exposign, 0);
+    *(double *)cols[col_idx] = val;
+    cols[col_idx] += sizeof(double);
+
+    if (p >= buf_end || c == '\n') {
+        goto rowend;
+    }
+    if (++col_idx == ncols) {
+        goto rowextra;
+    }
+    p++;
+    goto i0_cell;
+
+ rowextra:
+    /* more cells than the schema has columns */
+    p = find_row_end(p + 1, buf_end, sep);
+
+ rowend:
+    for (col_idx++; col_idx < ncols; col_idx++) {
+        if (CHUNK_COLUMN(chunk, col_idx).type == COL_TYPE_DOUBLE) {
+            *(double *)cols[col_idx] = common->missing_float_val;
+            cols[col_idx] += sizeof(double);
+        } else {
+            *(int64_t *)cols[col_idx] = common->missing_int_val;
+            cols[col_idx] += sizeof(int64_t);
+        }
+    }
+    col_idx = 0;
+    row_idx++;
+    p++;
+    if (row_idx < chunk->nrows) {
+        goto i0_cell;
+    }
+
+    if (common->stats != NULL) {
+        CHUNK_STATS(common, chunk)->nbytes = p - chunk->buf;
+        CHUNK_STATS(common, chunk)->nrows = chunk->nrows;
+    }
+
+    free(cols);
+
+    return 0;
+}
+
+static int
+fill_kernel_di(ThreadCommon *common, Chunk *chunk)
+{
+    const uchar *p;
+    const uchar *buf_end;
+    const uchar *cell;
+    const uchar *cellp;
+    int ncols = chunk->ncols;
+    int col_idx;
+    int row_idx;
+    int nquotes;
+    uchar c;
+    uchar **cols;  /* where the next cell of each column goes */
+    double val;
+    int digit;
+    int64_t value;
+    int expo;
+    int fracexpo;
+    int exposign;
+    const uchar sep = common->sep;
+
+    if (chunk->nrows == 0) {
+        return 0;
+    }
+
+    cols = (uchar **)malloc(ncols * sizeof(uchar *));
+    for (col_idx = 0; col_idx < ncols; col_idx++) {
+        cols[col_idx] = CHUNK_COLUMN(chunk, col_idx).arr_ptr;
+    }
+
+    buf_end = chunk->buf_end;
+    p = chunk->buf;
+    col_idx = 0;
+    row_idx = 0;
+
+ d0_cell:
+    cell = p;
+    cellp = p;
+    nquotes = 0;
+    value = 0;
+    expo = 0;
+    fracexpo = 0;
+    exposign = 1;
+
+    if (p >= buf_end) {  /* empty last cell */
+        c = 0;
+        goto d0_goodend;
+    }
+
+    c = *p;
+
+#define goodend d0_goodend
+#define badend d0_badend
+#define bad d0_bad
+
+    if (c == '"') {
+        ++nquotes;
+        ++cellp;
+        NEXTCHAR2_INQUOTES(goodend);
+
+#include "parser2_inquotes.h"
+
+    } else {
+
+#include "parser2.h"
+
+    }
+
+    if (nquotes != 1) {  /* c not in quotes */
+        if (c == '\r') {
+            NEXTCHAR_NOQUOTES(goodend);
+        }
+
+        if (c == sep || c == '\n') {
+            goto goodend;
+        }
+    }
+
+#undef goodend
+#undef badend
+#undef bad
+
+ d0_bad:
+    p = skip_cell(cell, buf_end, sep);
+    if (p < buf_end) {
+        c = *p;
+    }
+
+ d0_badend:
+    cellp = p;
+
+ d0_goodend:
+    val = (p == cellp) ? common->missing_float_val
+        : parsed_double(value, expo, fracexpo, exposign, 0);
+    *(double *)cols[col_idx] = val;
+    cols[col_idx] += sizeof(double);
+
+    if (p >= buf_end || c == '\n') {
+        goto rowend;
+    }
+    if (++col_idx == ncols) {
+        goto rowextra;
+    }
+    p++;
+    goto i1_cell;
+
+ i1_cell:
+    cell = p;
+    cellp = p;
+    nquotes = 0;
+    value = 0;
+    expo = 0;
+    fracexpo = 0;
+    exposign = 1;
+
+    if (p >= buf_end) {  /* empty last cell */
+        c = 0;
+        goto i1_goodend;
+    }
+
+    c = *p;
+
+#define goodend i1_goodend
+#define badend i1_badend
+#define bad i1_bad
+
+    if (c == '"') {
+        ++nquotes;
+        ++cellp;
+        NEXTCHAR2_INQUOTES(goodend);
+
+#include "parser2_inquotes.h"
+
+    } else {
+
+#include "parser2.h"
+
+    }
+
+    if (nquotes != 1) {  /* c not in quotes */
+        if (c == '\r') {
+            NEXTCHAR_NOQUOTES(goodend);
+        }
+
+        if (c == sep || c == '\n') {
+            goto goodend;
+        }
+    }
+
+#undef goodend
+#undef badend
+#undef bad
+
+ i1_bad:
+    p = skip_cell(cell, buf_end, sep);
+    if (p < buf_end) {
+        c = *p;
+    }
+
+ i1_badend:
+    cellp = p;
+
+ i1_goodend:
+    *(int64_t *)cols[col_idx] = (p == cellp || fracexpo != 0)
+        ? common->missing_int_val : value;
+    cols[col_idx] += sizeof(int64_t);
+
+    if (p >= buf_end || c == '\n') {
+        goto rowend;
+    }
+    if (++col_idx == ncols) {
+        goto rowextra;
+    }
+    p++;
+    goto d0_cell;
+
+ rowextra:
+    /* more cells than the schema has columns */
+    p = find_row_end(p + 1, buf_end, sep);
+
+ rowend:
+    for (col_idx++; col_idx < ncols; col_idx++) {
+        if (CHUNK_COLUMN(chunk, col_idx).type == COL_TYPE_DOUBLE) {
+            *(double *)cols[col_idx] = common->missing_float_val;
+            cols[col_idx] += sizeof(double);
+        } else {
+            *(int64_t *)cols[col_idx] = common->missing_int_val;
+            cols[col_idx] += sizeof(int64_t);
+        }
+    }
+    col_idx = 0;
+    row_idx++;
+    p++;
+    if (row_idx < chunk->nrows) {
+        goto d0_cell;
+    }
+
+    if (common->stats != NULL) {
+        CHUNK_STATS(common, chunk)->nbytes = p - chunk->buf;
+        CHUNK_STATS(common, chunk)->nrows = chunk->nrows;
+    }
+
+    free(cols);
+
+    return 0;
+}
+
+static const FillKernel fill_kernels[] = {
+    {"i", fill_kernel_i},
+    {"d", fill_kernel_d},
+    {"id", fill_kernel_id},
+    {"di", fill_kernel_di},
+    {NULL, NULL}
+};
@@ -0,0 +1,420 @@
+uint64_t pow5[] = {3362984268825341917L, 4203730336031677396L, 2627331460019798373L, 3284164325024747966L, 4105205406280934957L, 2565753378925584348L, 3207191723656980435L, 4008989654571225544L,
+2505618534107015965L, 3132023167633769956L, 3915028959542212446L, 2446893099713882778L, 3058616374642353473L, 3823270468302941842L, 2389544042689338651L, 2986930053361673314L,
+3733662566702091642L, 2333539104188807276L, 2916923880236009095L, 3646154850295011369L, 4557693562868764212L, 2848558476792977632L, 3560698095991222040L, 4450872619989027550L,
+2781795387493142219L, 3477244234366427774L, 4346555292958034717L, 2716597058098771698L, 3395746322623464623L, 4244682903279330778L, 2652926814549581736L, 3316158518186977171L,
+4145198147733721463L, 2590748842333575914L, 3238436052916969893L, 4048045066146212367L, 2530028166341382729L, 3162535207926728411L, 3953169009908410514L, 2470730631192756571L,
+3088413288990945714L, 3860516611238682143L, 2412822882024176339L, 3016028602530220424L, 3770035753162775530L, 2356272345726734706L, 2945340432158418383L, 3681675540198022979L,
+4602094425247528723L, 2876309015779705452L, 3595386269724631815L, 4494232837155789769L, 2808895523222368605L, 3511119404027960757L, 4388899255034950946L, 2743062034396844341L,
+3428827542996055427L, 4286034428745069283L, 2678771517965668302L, 3348464397457085377L, 4185580496821356722L, 2615987810513347951L, 3269984763141684939L, 4087480953927106174L,
+2554675596204441358L, 3193344495255551698L, 3991680619069439623L, 2494800386918399764L, 3118500483647999705L, 3898125604559999632L, 2436328502849999770L, 3045410628562499712L,
+3806763285703124640L, 2379227053564452900L, 2974033816955566125L, 3717542271194457656L, 2323463919496536035L, 2904329899370670044L, 3630412374213337555L, 4538015467766671944L,
+2836259667354169965L, 3545324584192712456L, 4431655730240890570L, 2769784831400556606L, 3462231039250695758L, 4327788799063369698L, 2704867999414606061L, 3381084999268257576L,
+4226356249085321970L, 2641472655678326231L, 3301840819597907789L, 4127301024497384737L, 2579563140310865460L, 3224453925388581825L, 4030567406735727282L, 2519104629209829551L,
+3148880786512286939L, 3936100983140358674L, 2460063114462724171L, 3075078893078405214L, 3843848616348006517L, 2402405385217504073L, 3003006731521880091L, 3753758414402350114L,
+2346099009001468821L, 2932623761251836027L, 3665779701564795034L, 4582224626955993792L, 2863890391847496120L, 3579862989809370150L, 4474828737261712688L, 2796767960788570430L,
+3495959950985713037L, 4369949938732141297L, 2731218711707588310L, 3414023389634485388L, 4267529237043106735L, 2667205773151941709L, 3334007216439927137L, 4167509020549908921L,
+2604693137843693075L, 3255866422304616344L, 4069833027880770430L, 2543645642425481519L, 3179557053031851899L, 3974446316289814873L, 2484028947681134296L, 3105036184601417870L,
+3881295230751772337L, 2425809519219857711L, 3032261899024822138L, 3790327373781027673L, 2368954608613142296L, 2961193260766427870L, 3701491575958034837L, 2313432234973771773L,
+2891790293717214716L, 3614737867146518396L, 4518422333933147995L, 2824013958708217496L, 3530017448385271871L, 4412521810481589838L, 2757826131550993649L, 3447282664438742061L,
+4309103330548427577L, 2693189581592767235L, 3366486976990959044L, 4208108721238698805L, 2630067950774186753L, 3287584938467733442L, 4109481173084666802L, 2568425733177916751L,
+3210532166472395939L, 4013165208090494924L, 2508228255056559327L, 3135285318820699159L, 3919106648525873949L, 2449441655328671218L, 3061802069160839023L, 3827252586451048778L,
+2392032866531905486L, 2990041083164881858L, 3737551353956102323L, 2335969596222563951L, 2919961995278204939L, 3649952494097756174L, 4562440617622195218L, 2851525386013872011L,
+3564406732517340014L, 4455508415646675018L, 2784692759779171886L, 3480865949723964857L, 4351082437154956072L, 2719426523221847545L, 3399283154027309431L, 4249103942534136789L,
+2655689964083835493L, 3319612455104794366L, 4149515568880992958L, 2593447230550620599L, 3241809038188275748L, 4052261297735344686L, 2532663311084590428L, 3165829138855738035L,
+3957286423569672544L, 2473304014731045340L, 3091630018413806675L, 3864537523017258344L, 2415335951885786465L, 3019169939857233081L, 3773962424821541352L, 2358726515513463345L,
+2948408144391829181L, 3685510180489786476L, 4606887725612233095L, 2879304828507645684L, 3599131035634557106L, 4498913794543196382L, 2811821121589497739L, 3514776401986872174L,
+4393470502483590217L, 2745919064052243885L, 3432398830065304857L, 4290498537581631071L, 2681561585988519419L, 3351951982485649274L, 4189939978107061593L, 2618712486316913496L,
+3273390607896141870L, 4091738259870177337L, 2557336412418860835L, 3196670515523576044L, 3995838144404470056L, 2497398840252793785L, 3121748550315992231L, 3902185687894990289L,
+2438866054934368930L, 3048582568667961163L, 3810728210834951454L, 2381705131771844658L, 2977131414714805823L, 3721414268393507279L, 2325883917745942049L, 2907354897182427562L,
+3634193621478034452L, 4542742026847543065L, 2839213766779714416L, 3549017208474643020L, 4436271510593303775L, 2772669694120814859L, 3465837117651018574L, 4332296397063773218L,
+2707685248164858261L, 3384606560206072826L, 4230758200257591033L, 2644223875160994395L, 3305279843951242994L, 4131599804939053743L, 2582249878086908589L, 3227812347608635737L,
+4034765434510794671L, 2521728396569246669L, 3152160495711558336L, 3940200619639447921L, 2462625387274654950L, 3078281734093318688L, 3847852167616648360L, 2404907604760405225L,
+3006134505950506531L, 3757668132438133164L, 2348542582773833227L, 2935678228467291534L, 3669597785584114418L, 4586997231980143023L, 2866873269987589389L, 3583591587484486736L,
+4479489484355608421L, 2799680927722255263L, 3499601159652819078L, 4374501449566023848L, 2734063405978764905L, 3417579257473456131L, 4271974071841820164L, 2669983794901137602L,
+3337479743626422003L, 4171849679533027504L, 2607406049708142190L, 3259257562135177738L, 4074071952668972172L, 2546294970418107607L, 3182868713022634509L, 3978585891278293137L,
+2486616182048933210L, 3108270227561166513L, 3885337784451458141L, 2428336115282161338L, 3035420144102701673L, 3794275180128377091L, 2371421987580235682L, 2964277484475294602L,
+3705346855594118253L, 2315841784746323908L, 2894802230932904885L, 3618502788666131106L, 4523128485832663883L, 2826955303645414927L, 3533694129556768659L, 4417117661945960823L,
+2760698538716225514L, 3450873173395281893L, 4313591466744102367L, 2695994666715063979L, 3369993333393829974L, 4212491666742287467L, 2632807291713929667L, 3291009114642412084L,
+4113761393303015105L, 2571100870814384440L, 3213876088517980551L, 4017345110647475688L, 2510840694154672305L, 3138550867693340381L, 3923188584616675477L, 2451992865385422173L,
+3064991081731777716L, 3831238852164722145L, 2394524282602951341L, 2993155353253689176L, 3741444191567111470L, 2338402619729444669L, 2923003274661805836L, 3653754093327257295L,
+4567192616659071619L, 2854495385411919762L, 3568119231764899702L, 4460149039706124628L, 2787593149816327892L, 3484491437270409865L, 4355614296588012332L, 2722258935367507707L,
+3402823669209384634L, 4253529586511730793L, 2658455991569831745L, 3323069989462289682L, 4153837486827862102L, 2596148429267413814L, 3245185536584267267L, 4056481920730334084L,
+2535301200456458802L, 3169126500570573503L, 3961408125713216879L, 2475880078570760549L, 3094850098213450687L, 3868562622766813359L, 2417851639229258349L, 3022314549036572936L,
+3777893186295716170L, 2361183241434822606L, 2951479051793528258L, 3689348814741910323L, 4611686018427387904L, 2882303761517117440L, 3602879701896396800L, 4503599627370496000L,
+2814749767106560000L, 3518437208883200000L, 4398046511104000000L, 2748779069440000000L, 3435973836800000000L, 4294967296000000000L, 2684354560000000000L, 3355443200000000000L,
+4194304000000000000L, 2621440000000000000L, 3276800000000000000L, 4096000000000000000L, 2560000000000000000L, 3200000000000000000L, 4000000000000000000L, 2500000000000000000L,
+3125000000000000000L, 3906250000000000000L, 2441406250000000000L, 3051757812500000000L, 3814697265625000000L, 2384185791015625000L, 2980232238769531250L, 3725290298461914062L,
+2328306436538696289L, 2910383045673370361L, 3637978807091712951L, 4547473508864641189L, 2842170943040400743L, 3552713678800500929L, 4440892098500626161L, 2775557561562891351L,
+3469446951953614188L, 4336808689942017736L, 2710505431213761085L, 3388131789017201356L, 4235164736271501695L, 2646977960169688559L, 3308722450212110699L, 4135903062765138374L,
+2584939414228211483L, 3231174267785264354L, 4038967834731580443L, 2524354896707237777L, 3155443620884047221L, 3944304526105059027L, 2465190328815661891L, 3081487911019577364L,
+3851859888774471706L, 2407412430484044816L, 3009265538105056020L, 3761581922631320025L, 2350988701644575015L, 2938735877055718769L, 3673419846319648462L, 4591774807899560578L,
+2869859254937225361L, 3587324068671531701L, 4484155085839414626L, 2802596928649634141L, 3503246160812042677L, 4379057701015053346L, 2736911063134408341L, 3421138828918010427L,
+4276423536147513033L, 2672764710092195646L, 3340955887615244557L, 4176194859519055697L, 2610121787199409810L, 3262652233999262263L, 4078315292499077829L, 2548947057811923643L,
+3186183822264904554L, 3982729777831130692L, 2489206111144456682L, 3111507638930570853L, 3889384548663213566L, 2430865342914508479L, 3038581678643135599L, 3798227098303919498L,
+2373891936439949686L, 2967364920549937108L, 3709206150687421385L, 2318253844179638366L, 2897817305224547957L, 3622271631530684947L, 4527839539413356183L, 2829899712133347614L,
+3537374640166684518L, 4421718300208355648L, 2763573937630222280L, 3454467422037777850L, 4318084277547222312L, 2698802673467013945L, 3373503341833767431L, 4216879177292209289L,
+2635549485807630806L, 3294436857259538507L, 4118046071574423134L, 2573778794734014459L, 3217223493417518073L, 4021529366771897592L, 2513455854232435995L, 3141819817790544993L,
+3927274772238181242L, 2454546732648863276L, 3068183415811079095L, 3835229269763848869L, 2397018293602405543L, 2996272867003006929L, 3745341083753758661L, 2340838177346099163L,
+2926047721682623954L, 3657559652103279943L, 4571949565129099928L, 2857468478205687455L, 3571835597757109319L, 4464794497196386649L, 2790496560747741655L, 3488120700934677069L,
+4360150876168346337L, 2725094297605216460L, 3406367872006520575L, 4257959840008150719L, 2661224900005094199L, 3326531125006367749L, 4158163906257959687L, 2598852441411224804L,
+3248565551764031005L, 4060706939705038757L, 2537941837315649223L, 3172427296644561529L, 3965534120805701911L, 2478458825503563694L, 3098073531879454618L, 3872591914849318272L,
+2420369946780823920L, 3025462433476029900L, 3781828041845037375L, 2363642526153148359L, 2954553157691435449L, 3693191447114294312L, 2308244654446433945L, 2885305818058042431L,
+3606632272572553039L, 4508290340715691299L, 2817681462947307061L, 3522101828684133827L, 4402627285855167284L, 2751642053659479552L, 3439552567074349440L, 4299440708842936801L,
+2687150443026835500L, 3358938053783544375L, 4198672567229430469L, 2624170354518394043L, 3280212943147992554L, 4100266178934990693L, 2562666361834369183L, 3203332952292961479L,
+4004166190366201848L, 2502603868978876155L, 3128254836223595194L, 3910318545279493993L, 2443949090799683745L, 3054936363499604682L, 3818670454374505852L, 2386669033984066157L,
+2983336292480082697L, 3729170365600103371L, 2330731478500064607L, 2913414348125080759L, 3641767935156350948L, 4552209918945438686L, 2845131199340899178L, 3556413999176123973L,
+4445517498970154966L, 2778448436856346854L, 3473060546070433567L, 4341325682588041959L, 2713328551617526224L, 3391660689521907781L, 4239575861902384726L, 2649734913688990454L,
+3312168642111238067L, 4140210802639047584L, 2587631751649404740L, 3234539689561755925L, 4043174611952194906L, 2526984132470121816L, 3158730165587652270L, 3948412706984565338L,
+2467757941865353336L, 3084697427331691670L, 3855871784164614588L, 2409919865102884117L, 3012399831378605147L, 3765499789223256433L, 2353437368264535271L, 2941796710330669089L,
+3677245887913336361L, 4596557359891670451L, 2872848349932294032L, 3591060437415367540L, 4488825546769209425L, 2805515966730755890L, 3506894958413444863L, 4383618698016806079L,
+2739761686260503799L, 3424702107825629749L, 4280877634782037187L, 2675548521738773241L, 3344435652173466552L, 4180544565216833190L, 2612840353260520744L, 3266050441575650930L,
+4082563051969563662L, 2551601907480977289L, 3189502384351221611L, 3986877980439027014L, 2491798737774391883L, 3114748422217989854L, 3893435527772487318L, 2433397204857804574L,
+3041746506072255717L, 3802183132590319647L, 2376364457868949779L, 2970455572336187224L, 3713069465420234030L, 2320668415887646268L, 2900835519859557836L, 3626044399824447295L,
+4532555499780559119L, 2832847187362849449L, 3541058984203561811L, 4426323730254452264L, 2766452331409032665L, 3458065414261290831L, 4322581767826613539L, 2701613604891633462L,
+3377017006114541827L, 4221271257643177284L, 2638294536026985803L, 3297868170033732253L, 4122335212542165317L, 2576459507838853323L, 3220574384798566654L, 4025717980998208317L,
+2516073738123880198L, 3145092172654850248L, 3931365215818562810L, 2457103259886601756L, 3071379074858252195L, 3839223843572815244L, 2399514902233009527L, 2999393627791261909L,
+3749242034739077387L, 2343276271711923366L, 2929095339639904208L, 3661369174549880260L, 4576711468187350325L, 2860444667617093953L, 3575555834521367442L, 4469444793151709302L,
+2793402995719818314L, 3491753744649772892L, 4364692180812216115L, 2727932613007635072L, 3409915766259543840L, 4262394707824429800L, 2663996692390268625L, 3329995865487835781L,
+4162494831859794727L, 2601559269912371704L, 3251949087390464630L, 4064936359238080788L, 2540585224523800492L, 3175731530654750615L, 3969664413318438269L, 2481040258324023918L,
+3101300322905029898L, 3876625403631287372L, 2422890877269554608L, 3028613596586943260L, 3785766995733679075L, 2366104372333549421L, 2957630465416936777L, 3697038081771170971L,
+2310648801106981857L, 2888311001383727321L, 3610388751729659152L, 4512985939662073940L, 2820616212288796212L, 3525770265360995265L, 4407212831701244082L, 2754508019813277551L,
+3443135024766596939L, 4303918780958246174L, 2689949238098903858L, 3362436547623629823L, 4203045684529537279L, 2626903552830960799L, 3283629441038700999L, 4104536801298376249L,
+2565335500811485155L, 3206669376014356444L };
+int shift5[] = {-1129, -1126, -1122, -1119, -1116, -1112, -1109, -1106,
+-1102, -1099, -1096, -1092, -1089, -1086, -1082, -1079,
+-1076, -1072, -1069, -1066, -1063, -1059, -1056, -1053,
+-1049, -1046, -1043, -1039, -1036, -1033, -1029, -1026,
+-1023, -1019, -1016, -1013, -1009, -1006, -1003, -999,
+-996, -993, -989, -986, -983, -979, -976, -973,
+-970, -966, -963, -960, -956, -953, -950, -946,
+-943, -940, -936, -933, -930, -926, -923, -920,
+-916, -913, -910, -906, -903, -900, -896, -893,
+-890, -886, -883, -880, -876, -873, -870, -867,
+-863, -860, -857, -853, -850, -847, -843, -840,
+-837, -833, -830, -827, -823, -820, -817, -813,
+-810, -807, -803, -800, -797, -793, -790, -787,
+-783, -780, -777, -774, -770, -767, -764, -760,
+-757, -754, -750, -747, -744, -740, -737, -734,
+-730, -727, -724, -720, -717, -714, -710, -707,
+-704, -700, -697, -694, -690, -687, -684, -680,
+-677, -674, -671, -667, -664, -661, -657, -654,
+-651, -647, -644, -641, -637, -634, -631, -627,
+-624, -621, -617, -614, -611, -607, -604, -601,
+-597, -594, -591, -587, -584, -581, -578, -574,
+-571, -568, -564, -561, -558, -554, -551, -548,
+-544, -541, -538, -534, -531, -528, -524, -521,
+-518, -514, -511, -508, -504, -501, -498, -494,
+-491, -488, -485, -481, -478, -475, -471, -468,
+-465, -461, -458, -455, -451, -448, -445, -441,
+-438, -435, -431, -428, -425, -421, -418, -415,
+-411, -408, -405, -401, -398, -395, -391, -388,
+-385, -382, -378, -375, -372, -368, -365, -362,
+-358, -355, -352, -348, -345, -342, -338, -335,
+-332, -328, -325, -322, -318, -315, -312, -308,
+-305, -302, -298, -295, -292, -289, -285, -282,
+-279, -275, -272, -269, -265, -262, -259, -255,
+-252, -249, -245, -242, -239, -235, -232, -229,
+-225, -222, -219, -215, -212, -209, -205, -202,
+-199, -195, -192, -189, -186, -182, -179, -176,
+-172, -169, -166, -162, -159, -156, -152, -149,
+-146, -142, -139, -136, -132, -129, -126, -122,
+-119, -116, -112, -109, -106, -102, -99, -96,
+-93, -89, -86, -83, -79, -76, -73, -69,
+-66, -63, -59, -56, -53, -49, -46, -43,
+-39, -36, -33, -29, -26, -23, -19, -16,
+-13, -9, -6, -3, 0, 4, 7, 10,
+14, 17, 20, 24, 27, 30, 34, 37,
+40, 44, 47, 50, 54, 57, 60, 64,
+67, 70, 74, 77, 80, 84, 87, 90,
+94, 97, 100, 103, 107, 110, 113, 117,
+120, 123, 127, 130, 133, 137, 140, 143,
+147, 150, 153, 157, 160, 163, 167, 170,
+173, 177, 180, 183, 187, 190, 193, 196,
+200, 203, 206, 210, 213, 216, 220, 223,
+226, 230, 233, 236, 240, 243, 246, 250,
+253, 256, 260, 263, 266, 270, 273, 276,
+280, 283, 286, 290, 293, 296, 299, 303,
+306, 309, 313, 316, 319, 323, 326, 329,
+333, 336, 339, 343, 346, 349, 353, 356,
+359, 363, 366, 369, 373, 376, 379, 383,
+386, 389, 392, 396, 399, 402, 406, 409,
+412, 416, 419, 422, 426, 429, 432, 436,
+439, 442, 446, 449, 452, 456, 459, 462,
+466, 469, 472, 476, 479, 482, 486, 489,
+492, 495, 499, 502, 505, 509, 512, 515,
+519, 522, 525, 529, 532, 535, 539, 542,
+545, 549, 552, 555, 559, 562, 565, 569,
+572, 575, 579, 582, 585, 588, 592, 595,
+598, 602, 605, 608, 612, 615, 618, 622,
+625, 628, 632, 635, 638, 642, 645, 648,
+652, 655, 658, 662, 665, 668, 672, 675,
+678, 681, 685, 688, 691, 695, 698, 701,
+705, 708, 711, 715, 718, 721, 725, 728,
+731, 735, 738, 741, 745, 748, 751, 755,
+758, 761, 765, 768, 771, 775, 778, 781,
+784, 788, 791, 794, 798, 801, 804, 808,
+811, 814, 818, 821, 824, 828, 831, 834,
+838, 841, 844, 848, 851, 854, 858, 861,
+864, 868, 871, 874, 877, 881, 884, 887,
+891, 894, 897, 901, 904, 907, 911, 914,
+917, 921, 924, 927, 931, 934, 937, 941,
+944, 947, 951, 954, 957, 961, 964, 967,
+971, 974, 977, 980, 984, 987, 990, 994,
+997, 1000, 1004, 1007, 1010, 1014, 1017, 1020,
+1024, 1027 };
+double pow2[] = {2.2250738585072014e-308, 4.4501477170144028e-308, 8.9002954340288055e-308, 1.7800590868057611e-307, 3.5601181736115222e-307, 7.1202363472230444e-307, 1.4240472694446089e-306, 2.8480945388892178e-306,
+5.6961890777784355e-306, 1.1392378155556871e-305, 2.2784756311113742e-305, 4.5569512622227484e-305, 9.1139025244454969e-305, 1.8227805048890994e-304, 3.6455610097781987e-304, 7.2911220195563975e-304,
+1.4582244039112795e-303, 2.916448807822559e-303, 5.832897615645118e-303, 1.1665795231290236e-302, 2.3331590462580472e-302, 4.6663180925160944e-302, 9.3326361850321888e-302, 1.8665272370064378e-301,
+3.7330544740128755e-301, 7.466108948025751e-301, 1.4932217896051502e-300, 2.9864435792103004e-300, 5.9728871584206008e-300, 1.1945774316841202e-299, 2.3891548633682403e-299, 4.7783097267364807e-299,
+9.5566194534729613e-299, 1.9113238906945923e-298, 3.8226477813891845e-298, 7.6452955627783691e-298, 1.5290591125556738e-297, 3.0581182251113476e-297, 6.1162364502226952e-297, 1.223247290044539e-296,
+2.4464945800890781e-296, 4.8929891601781562e-296, 9.7859783203563124e-296, 1.9571956640712625e-295, 3.914391328142525e-295, 7.8287826562850499e-295, 1.56575653125701e-294, 3.13151306251402e-294,
+6.2630261250280399e-294, 1.252605225005608e-293, 2.505210450011216e-293, 5.0104209000224319e-293, 1.0020841800044864e-292, 2.0041683600089728e-292, 4.0083367200179456e-292, 8.0166734400358911e-292,
+1.6033346880071782e-291, 3.2066693760143564e-291, 6.4133387520287129e-291, 1.2826677504057426e-290, 2.5653355008114852e-290, 5.1306710016229703e-290, 1.0261342003245941e-289, 2.0522684006491881e-289,
+4.1045368012983762e-289, 8.2090736025967525e-289, 1.6418147205193505e-288, 3.283629441038701e-288, 6.567258882077402e-288, 1.3134517764154804e-287, 2.6269035528309608e-287, 5.2538071056619216e-287,
+1.0507614211323843e-286, 2.1015228422647686e-286, 4.2030456845295373e-286, 8.4060913690590746e-286, 1.6812182738118149e-285, 3.3624365476236298e-285, 6.7248730952472596e-285, 1.3449746190494519e-284,
+2.6899492380989039e-284, 5.3798984761978077e-284, 1.0759796952395615e-283, 2.1519593904791231e-283, 4.3039187809582462e-283, 8.6078375619164923e-283, 1.7215675123832985e-282, 3.4431350247665969e-282,
+6.8862700495331939e-282, 1.3772540099066388e-281, 2.7545080198132776e-281, 5.5090160396265551e-281, 1.101803207925311e-280, 2.203606415850622e-280, 4.4072128317012441e-280, 8.8144256634024882e-280,
+1.7628851326804976e-279, 3.5257702653609953e-279, 7.0515405307219905e-279, 1.4103081061443981e-278, 2.8206162122887962e-278, 5.6412324245775924e-278, 1.1282464849155185e-277, 2.256492969831037e-277,
+4.5129859396620739e-277, 9.0259718793241479e-277, 1.8051943758648296e-276, 3.6103887517296592e-276, 7.2207775034593183e-276, 1.4441555006918637e-275, 2.8883110013837273e-275, 5.7766220027674546e-275,
+1.1553244005534909e-274, 2.3106488011069819e-274, 4.6212976022139637e-274, 9.2425952044279274e-274, 1.8485190408855855e-273, 3.697038081771171e-273, 7.3940761635423419e-273, 1.4788152327084684e-272,
+2.9576304654169368e-272, 5.9152609308338736e-272, 1.1830521861667747e-271, 2.3661043723335494e-271, 4.7322087446670988e-271, 9.4644174893341977e-271, 1.8928834978668395e-270, 3.7857669957336791e-270,
+7.5715339914673582e-270, 1.5143067982934716e-269, 3.0286135965869433e-269, 6.0572271931738865e-269, 1.2114454386347773e-268, 2.4228908772695546e-268, 4.8457817545391092e-268, 9.6915635090782184e-268,
+1.9383127018156437e-267, 3.8766254036312874e-267, 7.7532508072625747e-267, 1.5506501614525149e-266, 3.1013003229050299e-266, 6.2026006458100598e-266, 1.240520129162012e-265, 2.4810402583240239e-265,
+4.9620805166480478e-265, 9.9241610332960957e-265, 1.9848322066592191e-264, 3.9696644133184383e-264, 7.9393288266368765e-264, 1.5878657653273753e-263, 3.1757315306547506e-263, 6.3514630613095012e-263,
+1.2702926122619002e-262, 2.5405852245238005e-262, 5.081170449047601e-262, 1.0162340898095202e-261, 2.0324681796190404e-261, 4.0649363592380808e-261, 8.1298727184761616e-261, 1.6259745436952323e-260,
+3.2519490873904646e-260, 6.5038981747809293e-260, 1.3007796349561859e-259, 2.6015592699123717e-259, 5.2031185398247434e-259, 1.0406237079649487e-258, 2.0812474159298974e-258, 4.1624948318597947e-258,
+8.3249896637195895e-258, 1.6649979327439179e-257, 3.3299958654878358e-257, 6.6599917309756716e-257, 1.3319983461951343e-256, 2.6639966923902686e-256, 5.3279933847805373e-256, 1.0655986769561075e-255,
+2.1311973539122149e-255, 4.2623947078244298e-255, 8.5247894156488596e-255, 1.7049578831297719e-254, 3.4099157662595438e-254, 6.8198315325190877e-254, 1.3639663065038175e-253, 2.7279326130076351e-253,
+5.4558652260152701e-253, 1.091173045203054e-252, 2.1823460904061081e-252, 4.3646921808122161e-252, 8.7293843616244322e-252, 1.7458768723248864e-251, 3.4917537446497729e-251, 6.9835074892995458e-251,
+1.3967014978599092e-250, 2.7934029957198183e-250, 5.5868059914396366e-250, 1.1173611982879273e-249, 2.2347223965758547e-249, 4.4694447931517093e-249, 8.9388895863034186e-249, 1.7877779172606837e-248,
+3.5755558345213674e-248, 7.1511116690427349e-248, 1.430222333808547e-247, 2.860444667617094e-247, 5.7208893352341879e-247, 1.1441778670468376e-246, 2.2883557340936752e-246, 4.5767114681873503e-246,
+9.1534229363747007e-246, 1.8306845872749401e-245, 3.6613691745498803e-245, 7.3227383490997605e-245, 1.4645476698199521e-244, 2.9290953396399042e-244, 5.8581906792798084e-244, 1.1716381358559617e-243,
+2.3432762717119234e-243, 4.6865525434238467e-243, 9.3731050868476935e-243, 1.8746210173695387e-242, 3.7492420347390774e-242, 7.4984840694781548e-242, 1.499696813895631e-241, 2.9993936277912619e-241,
+5.9987872555825238e-241, 1.1997574511165048e-240, 2.3995149022330095e-240, 4.7990298044660191e-240, 9.5980596089320381e-240, 1.9196119217864076e-239, 3.8392238435728152e-239, 7.6784476871456305e-239,
+1.5356895374291261e-238, 3.0713790748582522e-238, 6.1427581497165044e-238, 1.2285516299433009e-237, 2.4571032598866018e-237, 4.9142065197732035e-237, 9.828413039546407e-237, 1.9656826079092814e-236,
+3.9313652158185628e-236, 7.8627304316371256e-236, 1.5725460863274251e-235, 3.1450921726548502e-235, 6.2901843453097005e-235, 1.2580368690619401e-234, 2.5160737381238802e-234, 5.0321474762477604e-234,
+1.0064294952495521e-233, 2.0128589904991042e-233, 4.0257179809982083e-233, 8.0514359619964166e-233, 1.6102871923992833e-232, 3.2205743847985667e-232, 6.4411487695971333e-232, 1.2882297539194267e-231,
+2.5764595078388533e-231, 5.1529190156777066e-231, 1.0305838031355413e-230, 2.0611676062710827e-230, 4.1223352125421653e-230, 8.2446704250843306e-230, 1.6489340850168661e-229, 3.2978681700337323e-229,
+6.5957363400674645e-229, 1.3191472680134929e-228, 2.6382945360269858e-228, 5.2765890720539716e-228, 1.0553178144107943e-227, 2.1106356288215886e-227, 4.2212712576431773e-227, 8.4425425152863546e-227,
+1.6885085030572709e-226, 3.3770170061145418e-226, 6.7540340122290837e-226, 1.3508068024458167e-225, 2.7016136048916335e-225, 5.4032272097832669e-225, 1.0806454419566534e-224, 2.1612908839133068e-224,
+4.3225817678266135e-224, 8.6451635356532271e-224, 1.7290327071306454e-223, 3.4580654142612908e-223, 6.9161308285225817e-223, 1.3832261657045163e-222, 2.7664523314090327e-222, 5.5329046628180653e-222,
+1.1065809325636131e-221, 2.2131618651272261e-221, 4.4263237302544523e-221, 8.8526474605089045e-221, 1.7705294921017809e-220, 3.5410589842035618e-220, 7.0821179684071236e-220, 1.4164235936814247e-219,
+2.8328471873628494e-219, 5.6656943747256989e-219, 1.1331388749451398e-218, 2.2662777498902796e-218, 4.5325554997805591e-218, 9.0651109995611182e-218, 1.8130221999122236e-217, 3.6260443998244473e-217,
+7.2520887996488946e-217, 1.4504177599297789e-216, 2.9008355198595578e-216, 5.8016710397191157e-216, 1.1603342079438231e-215, 2.3206684158876463e-215, 4.6413368317752925e-215, 9.2826736635505851e-215,
+1.856534732710117e-214, 3.713069465420234e-214, 7.4261389308404681e-214, 1.4852277861680936e-213, 2.9704555723361872e-213, 5.9409111446723744e-213, 1.1881822289344749e-212, 2.3763644578689498e-212,
+4.7527289157378996e-212, 9.5054578314757991e-212, 1.9010915662951598e-211, 3.8021831325903196e-211, 7.6043662651806393e-211, 1.5208732530361279e-210, 3.0417465060722557e-210, 6.0834930121445114e-210,
+1.2166986024289023e-209, 2.4333972048578046e-209, 4.8667944097156091e-209, 9.7335888194312183e-209, 1.9467177638862437e-208, 3.8934355277724873e-208, 7.7868710555449746e-208, 1.5573742111089949e-207,
+3.1147484222179899e-207, 6.2294968444359797e-207, 1.2458993688871959e-206, 2.4917987377743919e-206, 4.9835974755487838e-206, 9.9671949510975675e-206, 1.9934389902195135e-205, 3.986877980439027e-205,
+7.973755960878054e-205, 1.5947511921756108e-204, 3.1895023843512216e-204, 6.3790047687024432e-204, 1.2758009537404886e-203, 2.5516019074809773e-203, 5.1032038149619546e-203, 1.0206407629923909e-202,
+2.0412815259847818e-202, 4.0825630519695637e-202, 8.1651261039391273e-202, 1.6330252207878255e-201, 3.2660504415756509e-201, 6.5321008831513019e-201, 1.3064201766302604e-200, 2.6128403532605207e-200,
+5.2256807065210415e-200, 1.0451361413042083e-199, 2.0902722826084166e-199, 4.1805445652168332e-199, 8.3610891304336664e-199, 1.6722178260867333e-198, 3.3444356521734666e-198, 6.6888713043469331e-198,
+1.3377742608693866e-197, 2.6755485217387732e-197, 5.3510970434775465e-197, 1.0702194086955093e-196, 2.1404388173910186e-196, 4.2808776347820372e-196, 8.5617552695640744e-196, 1.7123510539128149e-195,
+3.4247021078256297e-195, 6.8494042156512595e-195, 1.3698808431302519e-194, 2.7397616862605038e-194, 5.4795233725210076e-194, 1.0959046745042015e-193, 2.191809349008403e-193, 4.3836186980168061e-193,
+8.7672373960336122e-193, 1.7534474792067224e-192, 3.5068949584134449e-192, 7.0137899168268897e-192, 1.4027579833653779e-191, 2.8055159667307559e-191, 5.6110319334615118e-191, 1.1222063866923024e-190,
+2.2444127733846047e-190, 4.4888255467692094e-190, 8.9776510935384189e-190, 1.7955302187076838e-189, 3.5910604374153675e-189, 7.1821208748307351e-189, 1.436424174966147e-188, 2.872848349932294e-188,
+5.7456966998645881e-188, 1.1491393399729176e-187, 2.2982786799458352e-187, 4.5965573598916705e-187, 9.1931147197833409e-187, 1.8386229439566682e-186, 3.6772458879133364e-186, 7.3544917758266727e-186,
+1.4708983551653345e-185, 2.9417967103306691e-185, 5.8835934206613382e-185, 1.1767186841322676e-184, 2.3534373682645353e-184, 4.7068747365290705e-184, 9.4137494730581411e-184, 1.8827498946116282e-183,
+3.7654997892232564e-183, 7.5309995784465129e-183, 1.5061999156893026e-182, 3.0123998313786051e-182, 6.0247996627572103e-182, 1.2049599325514421e-181, 2.4099198651028841e-181, 4.8198397302057682e-181,
+9.6396794604115365e-181, 1.9279358920823073e-180, 3.8558717841646146e-180, 7.7117435683292292e-180, 1.5423487136658458e-179, 3.0846974273316917e-179, 6.1693948546633833e-179, 1.2338789709326767e-178,
+2.4677579418653533e-178, 4.9355158837307067e-178, 9.8710317674614133e-178, 1.9742063534922827e-177, 3.9484127069845653e-177, 7.8968254139691307e-177, 1.5793650827938261e-176, 3.1587301655876523e-176,
+6.3174603311753045e-176, 1.2634920662350609e-175, 2.5269841324701218e-175, 5.0539682649402436e-175, 1.0107936529880487e-174, 2.0215873059760975e-174, 4.0431746119521949e-174, 8.0863492239043898e-174,
+1.617269844780878e-173, 3.2345396895617559e-173, 6.4690793791235119e-173, 1.2938158758247024e-172, 2.5876317516494047e-172, 5.1752635032988095e-172, 1.0350527006597619e-171, 2.0701054013195238e-171,
+4.1402108026390476e-171, 8.2804216052780952e-171, 1.656084321055619e-170, 3.3121686421112381e-170, 6.6243372842224761e-170, 1.3248674568444952e-169, 2.6497349136889905e-169, 5.2994698273779809e-169,
+1.0598939654755962e-168, 2.1197879309511924e-168, 4.2395758619023847e-168, 8.4791517238047695e-168, 1.6958303447609539e-167, 3.3916606895219078e-167, 6.7833213790438156e-167, 1.3566642758087631e-166,
+2.7133285516175262e-166, 5.4266571032350524e-166, 1.0853314206470105e-165, 2.170662841294021e-165, 4.341325682588042e-165, 8.6826513651760839e-165, 1.7365302730352168e-164, 3.4730605460704336e-164,
+6.9461210921408671e-164, 1.3892242184281734e-163, 2.7784484368563469e-163, 5.5568968737126937e-163, 1.1113793747425387e-162, 2.2227587494850775e-162, 4.445517498970155e-162, 8.8910349979403099e-162,
+1.778206999588062e-161, 3.556413999176124e-161, 7.1128279983522479e-161, 1.4225655996704496e-160, 2.8451311993408992e-160, 5.6902623986817984e-160, 1.1380524797363597e-159, 2.2761049594727193e-159,
+4.5522099189454387e-159, 9.1044198378908774e-159, 1.8208839675781755e-158, 3.6417679351563509e-158, 7.2835358703127019e-158, 1.4567071740625404e-157, 2.9134143481250808e-157, 5.8268286962501615e-157,
+1.1653657392500323e-156, 2.3307314785000646e-156, 4.6614629570001292e-156, 9.3229259140002584e-156, 1.8645851828000517e-155, 3.7291703656001034e-155, 7.4583407312002067e-155, 1.4916681462400413e-154,
+2.9833362924800827e-154, 5.9666725849601654e-154, 1.1933345169920331e-153, 2.3866690339840662e-153, 4.7733380679681323e-153, 9.5466761359362646e-153, 1.9093352271872529e-152, 3.8186704543745059e-152,
+7.6373409087490117e-152, 1.5274681817498023e-151, 3.0549363634996047e-151, 6.1098727269992094e-151, 1.2219745453998419e-150, 2.4439490907996837e-150, 4.8878981815993675e-150, 9.775796363198735e-150,
+1.955159272639747e-149, 3.910318545279494e-149, 7.820637090558988e-149, 1.5641274181117976e-148, 3.1282548362235952e-148, 6.2565096724471904e-148, 1.2513019344894381e-147, 2.5026038689788762e-147,
+5.0052077379577523e-147, 1.0010415475915505e-146, 2.0020830951831009e-146, 4.0041661903662018e-146, 8.0083323807324037e-146, 1.6016664761464807e-145, 3.2033329522929615e-145, 6.406665904585923e-145,
+1.2813331809171846e-144, 2.5626663618343692e-144, 5.1253327236687384e-144, 1.0250665447337477e-143, 2.0501330894674953e-143, 4.1002661789349907e-143, 8.2005323578699814e-143, 1.6401064715739963e-142,
+3.2802129431479926e-142, 6.5604258862959851e-142, 1.312085177259197e-141, 2.624170354518394e-141, 5.2483407090367881e-141, 1.0496681418073576e-140, 2.0993362836147152e-140, 4.1986725672294305e-140,
+8.3973451344588609e-140, 1.6794690268917722e-139, 3.3589380537835444e-139, 6.7178761075670888e-139, 1.3435752215134178e-138, 2.6871504430268355e-138, 5.374300886053671e-138, 1.0748601772107342e-137,
+2.1497203544214684e-137, 4.2994407088429368e-137, 8.5988814176858736e-137, 1.7197762835371747e-136, 3.4395525670743494e-136, 6.8791051341486989e-136, 1.3758210268297398e-135, 2.7516420536594796e-135,
+5.5032841073189591e-135, 1.1006568214637918e-134, 2.2013136429275836e-134, 4.4026272858551673e-134, 8.8052545717103346e-134, 1.7610509143420669e-133, 3.5221018286841338e-133, 7.0442036573682677e-133,
+1.4088407314736535e-132, 2.8176814629473071e-132, 5.6353629258946141e-132, 1.1270725851789228e-131, 2.2541451703578456e-131, 4.5082903407156913e-131, 9.0165806814313826e-131, 1.8033161362862765e-130,
+3.606632272572553e-130, 7.2132645451451061e-130, 1.4426529090290212e-129, 2.8853058180580424e-129, 5.7706116361160849e-129, 1.154122327223217e-128, 2.3082446544464339e-128, 4.6164893088928679e-128,
+9.2329786177857358e-128, 1.8465957235571472e-127, 3.6931914471142943e-127, 7.3863828942285886e-127, 1.4772765788457177e-126, 2.9545531576914354e-126, 5.9091063153828709e-126, 1.1818212630765742e-125,
+2.3636425261531484e-125, 4.7272850523062967e-125, 9.4545701046125934e-125, 1.8909140209225187e-124, 3.7818280418450374e-124, 7.5636560836900748e-124, 1.512731216738015e-123, 3.0254624334760299e-123,
+6.0509248669520598e-123, 1.210184973390412e-122, 2.4203699467808239e-122, 4.8407398935616478e-122, 9.6814797871232957e-122, 1.9362959574246591e-121, 3.8725919148493183e-121, 7.7451838296986365e-121,
+1.5490367659397273e-120, 3.0980735318794546e-120, 6.1961470637589092e-120, 1.2392294127517818e-119, 2.4784588255035637e-119, 4.9569176510071274e-119, 9.9138353020142548e-119, 1.982767060402851e-118,
+3.9655341208057019e-118, 7.9310682416114038e-118, 1.5862136483222808e-117, 3.1724272966445615e-117, 6.3448545932891231e-117, 1.2689709186578246e-116, 2.5379418373156492e-116, 5.0758836746312984e-116,
+1.0151767349262597e-115, 2.0303534698525194e-115, 4.0607069397050388e-115, 8.1214138794100775e-115, 1.6242827758820155e-114, 3.248565551764031e-114, 6.497131103528062e-114, 1.2994262207056124e-113,
+2.5988524414112248e-113, 5.1977048828224496e-113, 1.0395409765644899e-112, 2.0790819531289798e-112, 4.1581639062579597e-112, 8.3163278125159194e-112, 1.6632655625031839e-111, 3.3265311250063677e-111,
+6.6530622500127355e-111, 1.3306124500025471e-110, 2.6612249000050942e-110, 5.3224498000101884e-110, 1.0644899600020377e-109, 2.1289799200040754e-109, 4.2579598400081507e-109, 8.5159196800163014e-109,
+1.7031839360032603e-108, 3.4063678720065206e-108, 6.8127357440130412e-108, 1.3625471488026082e-107, 2.7250942976052165e-107, 5.4501885952104329e-107, 1.0900377190420866e-106, 2.1800754380841732e-106,
+4.3601508761683463e-106, 8.7203017523366927e-106, 1.7440603504673385e-105, 3.4881207009346771e-105, 6.9762414018693541e-105, 1.3952482803738708e-104, 2.7904965607477417e-104, 5.5809931214954833e-104,
+1.1161986242990967e-103, 2.2323972485981933e-103, 4.4647944971963866e-103, 8.9295889943927733e-103, 1.7859177988785547e-102, 3.5718355977571093e-102, 7.1436711955142186e-102, 1.4287342391028437e-101,
+2.8574684782056875e-101, 5.7149369564113749e-101, 1.142987391282275e-100, 2.28597478256455e-100, 4.5719495651290999e-100, 9.1438991302581999e-100, 1.82877982605164e-99, 3.6575596521032799e-99,
+7.3151193042065599e-99, 1.463023860841312e-98, 2.926047721682624e-98, 5.8520954433652479e-98, 1.1704190886730496e-97, 2.3408381773460992e-97, 4.6816763546921983e-97, 9.3633527093843967e-97,
+1.8726705418768793e-96, 3.7453410837537587e-96, 7.4906821675075173e-96, 1.4981364335015035e-95, 2.9962728670030069e-95, 5.9925457340060139e-95, 1.1985091468012028e-94, 2.3970182936024055e-94,
+4.7940365872048111e-94, 9.5880731744096222e-94, 1.9176146348819244e-93, 3.8352292697638489e-93, 7.6704585395276977e-93, 1.5340917079055395e-92, 3.0681834158110791e-92, 6.1363668316221582e-92,
+1.2272733663244316e-91, 2.4545467326488633e-91, 4.9090934652977266e-91, 9.8181869305954531e-91, 1.9636373861190906e-90, 3.9272747722381812e-90, 7.8545495444763625e-90, 1.5709099088952725e-89,
+3.141819817790545e-89, 6.28363963558109e-89, 1.256727927116218e-88, 2.513455854232436e-88, 5.026911708464872e-88, 1.0053823416929744e-87, 2.0107646833859488e-87, 4.0215293667718976e-87,
+8.0430587335437952e-87, 1.608611746708759e-86, 3.2172234934175181e-86, 6.4344469868350361e-86, 1.2868893973670072e-85, 2.5737787947340145e-85, 5.1475575894680289e-85, 1.0295115178936058e-84,
+2.0590230357872116e-84, 4.1180460715744231e-84, 8.2360921431488463e-84, 1.6472184286297693e-83, 3.2944368572595385e-83, 6.588873714519077e-83, 1.3177747429038154e-82, 2.6355494858076308e-82,
+5.2710989716152616e-82, 1.0542197943230523e-81, 2.1084395886461046e-81, 4.2168791772922093e-81, 8.4337583545844186e-81, 1.6867516709168837e-80, 3.3735033418337674e-80, 6.7470066836675349e-80,
+1.349401336733507e-79, 2.6988026734670139e-79, 5.3976053469340279e-79, 1.0795210693868056e-78, 2.1590421387736112e-78, 4.3180842775472223e-78, 8.6361685550944446e-78, 1.7272337110188889e-77,
+3.4544674220377779e-77, 6.9089348440755557e-77, 1.3817869688151111e-76, 2.7635739376302223e-76, 5.5271478752604446e-76, 1.1054295750520889e-75, 2.2108591501041778e-75, 4.4217183002083556e-75,
+8.8434366004167113e-75, 1.7686873200833423e-74, 3.5373746401666845e-74, 7.074749280333369e-74, 1.4149498560666738e-73, 2.8298997121333476e-73, 5.6597994242666952e-73, 1.131959884853339e-72,
+2.2639197697066781e-72, 4.5278395394133562e-72, 9.0556790788267124e-72, 1.8111358157653425e-71, 3.6222716315306849e-71, 7.2445432630613699e-71, 1.448908652612274e-70, 2.897817305224548e-70,
+5.7956346104490959e-70, 1.1591269220898192e-69, 2.3182538441796384e-69, 4.6365076883592767e-69, 9.2730153767185535e-69, 1.8546030753437107e-68, 3.7092061506874214e-68, 7.4184123013748428e-68,
+1.4836824602749686e-67, 2.9673649205499371e-67, 5.9347298410998742e-67, 1.1869459682199748e-66, 2.3738919364399497e-66, 4.7477838728798994e-66, 9.4955677457597987e-66, 1.8991135491519597e-65,
+3.7982270983039195e-65, 7.596454196607839e-65, 1.5192908393215678e-64, 3.0385816786431356e-64, 6.0771633572862712e-64, 1.2154326714572542e-63, 2.4308653429145085e-63, 4.861730685829017e-63,
+9.7234613716580339e-63, 1.9446922743316068e-62, 3.8893845486632136e-62, 7.7787690973264271e-62, 1.5557538194652854e-61, 3.1115076389305709e-61, 6.2230152778611417e-61, 1.2446030555722283e-60,
+2.4892061111444567e-60, 4.9784122222889134e-60, 9.9568244445778267e-60, 1.9913648889155653e-59, 3.9827297778311307e-59, 7.9654595556622614e-59, 1.5930919111324523e-58, 3.1861838222649046e-58,
+6.3723676445298091e-58, 1.2744735289059618e-57, 2.5489470578119236e-57, 5.0978941156238473e-57, 1.0195788231247695e-56, 2.0391576462495389e-56, 4.0783152924990778e-56, 8.1566305849981557e-56,
+1.6313261169996311e-55, 3.2626522339992623e-55, 6.5253044679985245e-55, 1.3050608935997049e-54, 2.6101217871994098e-54, 5.2202435743988196e-54, 1.0440487148797639e-53, 2.0880974297595278e-53,
+4.1761948595190557e-53, 8.3523897190381114e-53, 1.6704779438076223e-52, 3.3409558876152446e-52, 6.6819117752304891e-52, 1.3363823550460978e-51, 2.6727647100921956e-51, 5.3455294201843913e-51,
+1.0691058840368783e-50, 2.1382117680737565e-50, 4.276423536147513e-50, 8.5528470722950261e-50, 1.7105694144590052e-49, 3.4211388289180104e-49, 6.8422776578360209e-49, 1.3684555315672042e-48,
+2.7369110631344083e-48, 5.4738221262688167e-48, 1.0947644252537633e-47, 2.1895288505075267e-47, 4.3790577010150533e-47, 8.7581154020301067e-47, 1.7516230804060213e-46, 3.5032461608120427e-46,
+7.0064923216240854e-46, 1.4012984643248171e-45, 2.8025969286496341e-45, 5.6051938572992683e-45, 1.1210387714598537e-44, 2.2420775429197073e-44, 4.4841550858394146e-44, 8.9683101716788293e-44,
+1.7936620343357659e-43, 3.5873240686715317e-43, 7.1746481373430634e-43, 1.4349296274686127e-42, 2.8698592549372254e-42, 5.7397185098744507e-42, 1.1479437019748901e-41, 2.2958874039497803e-41,
+4.5917748078995606e-41, 9.1835496157991212e-41, 1.8367099231598242e-40, 3.6734198463196485e-40, 7.3468396926392969e-40, 1.4693679385278594e-39, 2.9387358770557188e-39, 5.8774717541114375e-39,
+1.1754943508222875e-38, 2.350988701644575e-38, 4.70197740328915e-38, 9.4039548065783001e-38, 1.88079096131566e-37, 3.76158192263132e-37, 7.5231638452626401e-37, 1.504632769052528e-36,
+3.009265538105056e-36, 6.018531076210112e-36, 1.2037062152420224e-35, 2.4074124304840448e-35, 4.8148248609680896e-35, 9.6296497219361793e-35, 1.9259299443872359e-34, 3.8518598887744717e-34,
+7.7037197775489434e-34, 1.5407439555097887e-33, 3.0814879110195774e-33, 6.1629758220391547e-33, 1.2325951644078309e-32, 2.4651903288156619e-32, 4.9303806576313238e-32, 9.8607613152626476e-32,
+1.9721522630525295e-31, 3.944304526105059e-31, 7.8886090522101181e-31, 1.5777218104420236e-30, 3.1554436208840472e-30, 6.3108872417680944e-30, 1.2621774483536189e-29, 2.5243548967072378e-29,
+5.0487097934144756e-29, 1.0097419586828951e-28, 2.0194839173657902e-28, 4.0389678347315804e-28, 8.0779356694631609e-28, 1.6155871338926322e-27, 3.2311742677852644e-27, 6.4623485355705287e-27,
+1.2924697071141057e-26, 2.5849394142282115e-26, 5.169878828456423e-26, 1.0339757656912846e-25, 2.0679515313825692e-25, 4.1359030627651384e-25, 8.2718061255302767e-25, 1.6543612251060553e-24,
+3.3087224502121107e-24, 6.6174449004242214e-24, 1.3234889800848443e-23, 2.6469779601696886e-23, 5.2939559203393771e-23, 1.0587911840678754e-22, 2.1175823681357508e-22, 4.2351647362715017e-22,
+8.4703294725430034e-22, 1.6940658945086007e-21, 3.3881317890172014e-21, 6.7762635780344027e-21, 1.3552527156068805e-20, 2.7105054312137611e-20, 5.4210108624275222e-20, 1.0842021724855044e-19,
+2.1684043449710089e-19, 4.3368086899420177e-19, 8.6736173798840355e-19, 1.7347234759768071e-18, 3.4694469519536142e-18, 6.9388939039072284e-18, 1.3877787807814457e-17, 2.7755575615628914e-17,
+5.5511151231257827e-17, 1.1102230246251565e-16, 2.2204460492503131e-16, 4.4408920985006262e-16, 8.8817841970012523e-16, 1.7763568394002505e-15, 3.5527136788005009e-15, 7.1054273576010019e-15,
+1.4210854715202004e-14, 2.8421709430404007e-14, 5.6843418860808015e-14, 1.1368683772161603e-13, 2.2737367544323206e-13, 4.5474735088646412e-13, 9.0949470177292824e-13, 1.8189894035458565e-12,
+3.637978807091713e-12, 7.2759576141834259e-12, 1.4551915228366852e-11, 2.9103830456733704e-11, 5.8207660913467407e-11, 1.1641532182693481e-10, 2.3283064365386963e-10, 4.6566128730773926e-10,
+9.3132257461547852e-10, 1.862645149230957e-09, 3.7252902984619141e-09, 7.4505805969238281e-09, 1.4901161193847656e-08, 2.9802322387695312e-08, 5.9604644775390625e-08, 1.1920928955078125e-07,
+2.384185791015625e-07, 4.76837158203125e-07, 9.5367431640625e-07, 1.9073486328125e-06, 3.814697265625e-06, 7.62939453125e-06, 1.52587890625e-05, 3.0517578125e-05,
+6.103515625e-05, 0.0001220703125, 0.000244140625, 0.00048828125, 0.0009765625, 0.001953125, 0.00390625, 0.0078125,
+0.015625, 0.03125, 0.0625, 0.125, 0.25, 0.5, 1, 2,
+4, 8, 16, 32, 64, 128, 256, 512,
+1024, 2048, 4096, 8192, 16384, 32768, 65536, 131072,
+262144, 524288, 1048576, 2097152, 4194304, 8388608, 16777216, 33554432,
+67108864, 134217728, 268435456, 536870912, 1073741824, 2147483648, 4294967296, 8589934592,
+17179869184, 34359738368, 68719476736, 137438953472, 274877906944, 549755813888, 1099511627776, 2199023255552,
+4398046511104, 8796093022208, 17592186044416, 35184372088832, 70368744177664, 140737488355328, 281474976710656, 562949953421312,
+1125899906842624, 2251799813685248, 4503599627370496, 9007199254740992, 18014398509481984, 36028797018963968, 72057594037927936, 1.4411518807585587e+17,
+2.8823037615171174e+17, 5.7646075230342349e+17, 1.152921504606847e+18, 2.305843009213694e+18, 4.6116860184273879e+18, 9.2233720368547758e+18, 1.8446744073709552e+19, 3.6893488147419103e+19,
+7.3786976294838206e+19, 1.4757395258967641e+20, 2.9514790517935283e+20, 5.9029581035870565e+20, 1.1805916207174113e+21, 2.3611832414348226e+21, 4.7223664828696452e+21, 9.4447329657392904e+21,
+1.8889465931478581e+22, 3.7778931862957162e+22, 7.5557863725914323e+22, 1.5111572745182865e+23, 3.0223145490365729e+23, 6.0446290980731459e+23, 1.2089258196146292e+24, 2.4178516392292583e+24,
+4.8357032784585167e+24, 9.6714065569170334e+24, 1.9342813113834067e+25, 3.8685626227668134e+25, 7.7371252455336267e+25, 1.5474250491067253e+26, 3.0948500982134507e+26, 6.1897001964269014e+26,
+1.2379400392853803e+27, 2.4758800785707605e+27, 4.9517601571415211e+27, 9.9035203142830422e+27, 1.9807040628566084e+28, 3.9614081257132169e+28, 7.9228162514264338e+28, 1.5845632502852868e+29,
+3.1691265005705735e+29, 6.338253001141147e+29, 1.2676506002282294e+30, 2.5353012004564588e+30, 5.0706024009129176e+30, 1.0141204801825835e+31, 2.028240960365167e+31, 4.0564819207303341e+31,
+8.1129638414606682e+31, 1.6225927682921336e+32, 3.2451855365842673e+32, 6.4903710731685345e+32, 1.2980742146337069e+33, 2.5961484292674138e+33, 5.1922968585348276e+33, 1.0384593717069655e+34,
+2.0769187434139311e+34, 4.1538374868278621e+34, 8.3076749736557242e+34, 1.6615349947311448e+35, 3.3230699894622897e+35, 6.6461399789245794e+35, 1.3292279957849159e+36, 2.6584559915698317e+36,
+5.3169119831396635e+36, 1.0633823966279327e+37, 2.1267647932558654e+37, 4.2535295865117308e+37, 8.5070591730234616e+37, 1.7014118346046923e+38, 3.4028236692093846e+38, 6.8056473384187693e+38,
+1.3611294676837539e+39, 2.7222589353675077e+39, 5.4445178707350154e+39, 1.0889035741470031e+40, 2.1778071482940062e+40, 4.3556142965880123e+40, 8.7112285931760247e+40, 1.7422457186352049e+41,
+3.4844914372704099e+41, 6.9689828745408197e+41, 1.3937965749081639e+42, 2.7875931498163279e+42, 5.5751862996326558e+42, 1.1150372599265312e+43, 2.2300745198530623e+43, 4.4601490397061246e+43,
+8.9202980794122493e+43, 1.7840596158824499e+44, 3.5681192317648997e+44, 7.1362384635297994e+44, 1.4272476927059599e+45, 2.8544953854119198e+45, 5.7089907708238395e+45, 1.1417981541647679e+46,
+2.2835963083295358e+46, 4.5671926166590716e+46, 9.1343852333181432e+46, 1.8268770466636286e+47, 3.6537540933272573e+47, 7.3075081866545146e+47, 1.4615016373309029e+48, 2.9230032746618058e+48,
+5.8460065493236117e+48, 1.1692013098647223e+49, 2.3384026197294447e+49, 4.6768052394588893e+49, 9.3536104789177787e+49, 1.8707220957835557e+50, 3.7414441915671115e+50, 7.4828883831342229e+50,
+1.4965776766268446e+51, 2.9931553532536892e+51, 5.9863107065073784e+51, 1.1972621413014757e+52, 2.3945242826029513e+52, 4.7890485652059027e+52, 9.5780971304118054e+52, 1.9156194260823611e+53,
+3.8312388521647221e+53, 7.6624777043294443e+53, 1.5324955408658889e+54, 3.0649910817317777e+54, 6.1299821634635554e+54, 1.2259964326927111e+55, 2.4519928653854222e+55, 4.9039857307708443e+55,
+9.8079714615416887e+55, 1.9615942923083377e+56, 3.9231885846166755e+56, 7.846377169233351e+56, 1.5692754338466702e+57, 3.1385508676933404e+57, 6.2771017353866808e+57, 1.2554203470773362e+58,
+2.5108406941546723e+58, 5.0216813883093446e+58, 1.0043362776618689e+59, 2.0086725553237378e+59, 4.0173451106474757e+59, 8.0346902212949514e+59, 1.6069380442589903e+60, 3.2138760885179806e+60,
+6.4277521770359611e+60, 1.2855504354071922e+61, 2.5711008708143844e+61, 5.1422017416287689e+61, 1.0284403483257538e+62, 2.0568806966515076e+62, 4.1137613933030151e+62, 8.2275227866060302e+62,
+1.645504557321206e+63, 3.2910091146424121e+63, 6.5820182292848242e+63, 1.3164036458569648e+64, 2.6328072917139297e+64, 5.2656145834278593e+64, 1.0531229166855719e+65, 2.1062458333711437e+65,
+4.2124916667422875e+65, 8.4249833334845749e+65, 1.684996666696915e+66, 3.36999333339383e+66, 6.7399866667876599e+66, 1.347997333357532e+67, 2.695994666715064e+67, 5.391989333430128e+67,
+1.0783978666860256e+68, 2.1567957333720512e+68, 4.3135914667441024e+68, 8.6271829334882047e+68, 1.7254365866976409e+69, 3.4508731733952819e+69, 6.9017463467905638e+69, 1.3803492693581128e+70,
+2.7606985387162255e+70, 5.521397077432451e+70, 1.1042794154864902e+71, 2.2085588309729804e+71, 4.4171176619459608e+71, 8.8342353238919216e+71, 1.7668470647783843e+72, 3.5336941295567687e+72,
+7.0673882591135373e+72, 1.4134776518227075e+73, 2.8269553036454149e+73, 5.6539106072908299e+73, 1.130782121458166e+74, 2.2615642429163319e+74, 4.5231284858326639e+74, 9.0462569716653278e+74,
+1.8092513943330656e+75, 3.6185027886661311e+75, 7.2370055773322622e+75, 1.4474011154664524e+76, 2.8948022309329049e+76, 5.7896044618658098e+76, 1.157920892373162e+77, 2.3158417847463239e+77,
+4.6316835694926478e+77, 9.2633671389852956e+77, 1.8526734277970591e+78, 3.7053468555941183e+78, 7.4106937111882365e+78, 1.4821387422376473e+79, 2.9642774844752946e+79, 5.9285549689505892e+79,
+1.1857109937901178e+80, 2.3714219875802357e+80, 4.7428439751604714e+80, 9.4856879503209427e+80, 1.8971375900641885e+81, 3.7942751801283771e+81, 7.5885503602567542e+81, 1.5177100720513508e+82,
+3.0354201441027017e+82, 6.0708402882054033e+82, 1.2141680576410807e+83, 2.4283361152821613e+83, 4.8566722305643227e+83, 9.7133444611286454e+83, 1.9426688922257291e+84, 3.8853377844514581e+84,
+7.7706755689029163e+84, 1.5541351137805833e+85, 3.1082702275611665e+85, 6.216540455122333e+85, 1.2433080910244666e+86, 2.4866161820489332e+86, 4.9732323640978664e+86, 9.9464647281957328e+86,
+1.9892929456391466e+87, 3.9785858912782931e+87, 7.9571717825565863e+87, 1.5914343565113173e+88, 3.1828687130226345e+88, 6.365737426045269e+88, 1.2731474852090538e+89, 2.5462949704181076e+89,
+5.0925899408362152e+89, 1.018517988167243e+90, 2.0370359763344861e+90, 4.0740719526689722e+90, 8.1481439053379443e+90, 1.6296287810675889e+91, 3.2592575621351777e+91, 6.5185151242703555e+91,
+1.3037030248540711e+92, 2.6074060497081422e+92, 5.2148120994162844e+92, 1.0429624198832569e+93, 2.0859248397665138e+93, 4.1718496795330275e+93, 8.343699359066055e+93, 1.668739871813211e+94,
+3.337479743626422e+94, 6.674959487252844e+94, 1.3349918974505688e+95, 2.6699837949011376e+95, 5.3399675898022752e+95, 1.067993517960455e+96, 2.1359870359209101e+96, 4.2719740718418202e+96,
+8.5439481436836403e+96, 1.7087896287367281e+97, 3.4175792574734561e+97, 6.8351585149469123e+97, 1.3670317029893825e+98, 2.7340634059787649e+98, 5.4681268119575298e+98, 1.093625362391506e+99,
+2.1872507247830119e+99, 4.3745014495660238e+99, 8.7490028991320477e+99, 1.7498005798264095e+100, 3.4996011596528191e+100, 6.9992023193056382e+100, 1.3998404638611276e+101, 2.7996809277222553e+101,
+5.5993618554445105e+101, 1.1198723710889021e+102, 2.2397447421778042e+102, 4.4794894843556084e+102, 8.9589789687112168e+102, 1.7917957937422434e+103, 3.5835915874844867e+103, 7.1671831749689735e+103,
+1.4334366349937947e+104, 2.8668732699875894e+104, 5.7337465399751788e+104, 1.1467493079950358e+105, 2.2934986159900715e+105, 4.586997231980143e+105, 9.173994463960286e+105, 1.8347988927920572e+106,
+3.6695977855841144e+106, 7.3391955711682288e+106, 1.4678391142336458e+107, 2.9356782284672915e+107, 5.8713564569345831e+107, 1.1742712913869166e+108, 2.3485425827738332e+108, 4.6970851655476665e+108,
+9.3941703310953329e+108, 1.8788340662190666e+109, 3.7576681324381332e+109, 7.5153362648762663e+109, 1.5030672529752533e+110, 3.0061345059505065e+110, 6.0122690119010131e+110, 1.2024538023802026e+111,
+2.4049076047604052e+111, 4.8098152095208105e+111, 9.6196304190416209e+111, 1.9239260838083242e+112, 3.8478521676166484e+112, 7.6957043352332967e+112, 1.5391408670466593e+113, 3.0782817340933187e+113,
+6.1565634681866374e+113, 1.2313126936373275e+114, 2.462625387274655e+114, 4.9252507745493099e+114, 9.8505015490986198e+114, 1.970100309819724e+115, 3.9402006196394479e+115, 7.8804012392788958e+115,
+1.5760802478557792e+116, 3.1521604957115583e+116, 6.3043209914231167e+116, 1.2608641982846233e+117, 2.5217283965692467e+117, 5.0434567931384933e+117, 1.0086913586276987e+118, 2.0173827172553973e+118,
+4.0347654345107947e+118, 8.0695308690215893e+118, 1.6139061738043179e+119, 3.2278123476086357e+119, 6.4556246952172715e+119, 1.2911249390434543e+120, 2.5822498780869086e+120, 5.1644997561738172e+120,
+1.0328999512347634e+121, 2.0657999024695269e+121, 4.1315998049390537e+121, 8.2631996098781075e+121, 1.6526399219756215e+122, 3.305279843951243e+122, 6.610559687902486e+122, 1.3221119375804972e+123,
+2.6442238751609944e+123, 5.2884477503219888e+123, 1.0576895500643978e+124, 2.1153791001287955e+124, 4.230758200257591e+124, 8.4615164005151821e+124, 1.6923032801030364e+125, 3.3846065602060728e+125,
+6.7692131204121457e+125, 1.3538426240824291e+126, 2.7076852481648583e+126, 5.4153704963297165e+126, 1.0830740992659433e+127, 2.1661481985318866e+127, 4.3322963970637732e+127, 8.6645927941275464e+127,
+1.7329185588255093e+128, 3.4658371176510186e+128, 6.9316742353020371e+128, 1.3863348470604074e+129, 2.7726696941208149e+129, 5.5453393882416297e+129, 1.1090678776483259e+130, 2.2181357552966519e+130,
+4.4362715105933038e+130, 8.8725430211866076e+130, 1.7745086042373215e+131, 3.549017208474643e+131, 7.098034416949286e+131, 1.4196068833898572e+132, 2.8392137667797144e+132, 5.6784275335594288e+132,
+1.1356855067118858e+133, 2.2713710134237715e+133, 4.5427420268475431e+133, 9.0854840536950861e+133, 1.8170968107390172e+134, 3.6341936214780345e+134, 7.2683872429560689e+134, 1.4536774485912138e+135,
+2.9073548971824276e+135, 5.8147097943648551e+135, 1.162941958872971e+136, 2.325883917745942e+136, 4.6517678354918841e+136, 9.3035356709837682e+136, 1.8607071341967536e+137, 3.7214142683935073e+137,
+7.4428285367870146e+137, 1.4885657073574029e+138, 2.9771314147148058e+138, 5.9542628294296116e+138, 1.1908525658859223e+139, 2.3817051317718447e+139, 4.7634102635436893e+139, 9.5268205270873786e+139,
+1.9053641054174757e+140, 3.8107282108349515e+140, 7.6214564216699029e+140, 1.5242912843339806e+141, 3.0485825686679612e+141, 6.0971651373359223e+141, 1.2194330274671845e+142, 2.4388660549343689e+142,
+4.8777321098687379e+142, 9.7554642197374757e+142, 1.9510928439474951e+143, 3.9021856878949903e+143, 7.8043713757899806e+143, 1.5608742751579961e+144, 3.1217485503159922e+144, 6.2434971006319845e+144,
+1.2486994201263969e+145, 2.4973988402527938e+145, 4.9947976805055876e+145, 9.9895953610111751e+145, 1.997919072202235e+146, 3.9958381444044701e+146, 7.9916762888089401e+146, 1.598335257761788e+147,
+3.196670515523576e+147, 6.3933410310471521e+147, 1.2786682062094304e+148, 2.5573364124188608e+148, 5.1146728248377217e+148, 1.0229345649675443e+149, 2.0458691299350887e+149, 4.0917382598701773e+149,
+8.1834765197403547e+149, 1.6366953039480709e+150, 3.2733906078961419e+150, 6.5467812157922837e+150, 1.3093562431584567e+151, 2.6187124863169135e+151, 5.237424972633827e+151, 1.0474849945267654e+152,
+2.0949699890535308e+152, 4.1899399781070616e+152, 8.3798799562141232e+152, 1.6759759912428246e+153, 3.3519519824856493e+153, 6.7039039649712985e+153, 1.3407807929942597e+154, 2.6815615859885194e+154,
+5.3631231719770388e+154, 1.0726246343954078e+155, 2.1452492687908155e+155, 4.2904985375816311e+155, 8.5809970751632621e+155, 1.7161994150326524e+156, 3.4323988300653049e+156, 6.8647976601306097e+156,
+1.3729595320261219e+157, 2.7459190640522439e+157, 5.4918381281044878e+157, 1.0983676256208976e+158, 2.1967352512417951e+158, 4.3934705024835902e+158, 8.7869410049671804e+158, 1.7573882009934361e+159,
+3.5147764019868722e+159, 7.0295528039737443e+159, 1.4059105607947489e+160, 2.8118211215894977e+160, 5.6236422431789955e+160, 1.1247284486357991e+161, 2.2494568972715982e+161, 4.4989137945431964e+161,
+8.9978275890863928e+161, 1.7995655178172786e+162, 3.5991310356345571e+162, 7.1982620712691142e+162, 1.4396524142538228e+163, 2.8793048285076457e+163, 5.7586096570152914e+163, 1.1517219314030583e+164,
+2.3034438628061165e+164, 4.6068877256122331e+164, 9.2137754512244662e+164, 1.8427550902448932e+165, 3.6855101804897865e+165, 7.371020360979573e+165, 1.4742040721959146e+166, 2.9484081443918292e+166,
+5.8968162887836584e+166, 1.1793632577567317e+167, 2.3587265155134633e+167, 4.7174530310269267e+167, 9.4349060620538534e+167, 1.8869812124107707e+168, 3.7739624248215414e+168, 7.5479248496430827e+168,
+1.5095849699286165e+169, 3.0191699398572331e+169, 6.0383398797144662e+169, 1.2076679759428932e+170, 2.4153359518857865e+170, 4.8306719037715729e+170, 9.6613438075431459e+170, 1.9322687615086292e+171,
+3.8645375230172583e+171, 7.7290750460345167e+171, 1.5458150092069033e+172, 3.0916300184138067e+172, 6.1832600368276134e+172, 1.2366520073655227e+173, 2.4733040147310453e+173, 4.9466080294620907e+173,
+9.8932160589241814e+173, 1.9786432117848363e+174, 3.9572864235696725e+174, 7.9145728471393451e+174, 1.582914569427869e+175, 3.165829138855738e+175, 6.3316582777114761e+175, 1.2663316555422952e+176,
+2.5326633110845904e+176, 5.0653266221691809e+176, 1.0130653244338362e+177, 2.0261306488676723e+177, 4.0522612977353447e+177, 8.1045225954706894e+177, 1.6209045190941379e+178, 3.2418090381882757e+178,
+6.4836180763765515e+178, 1.2967236152753103e+179, 2.5934472305506206e+179, 5.1868944611012412e+179, 1.0373788922202482e+180, 2.0747577844404965e+180, 4.149515568880993e+180, 8.2990311377619859e+180,
+1.6598062275523972e+181, 3.3196124551047944e+181, 6.6392249102095887e+181, 1.3278449820419177e+182, 2.6556899640838355e+182, 5.311379928167671e+182, 1.0622759856335342e+183, 2.1245519712670684e+183,
+4.2491039425341368e+183, 8.4982078850682736e+183, 1.6996415770136547e+184, 3.3992831540273094e+184, 6.7985663080546189e+184, 1.3597132616109238e+185, 2.7194265232218475e+185, 5.4388530464436951e+185,
+1.087770609288739e+186, 2.175541218577478e+186, 4.3510824371549561e+186, 8.7021648743099121e+186, 1.7404329748619824e+187, 3.4808659497239649e+187, 6.9617318994479297e+187, 1.3923463798895859e+188,
+2.7846927597791719e+188, 5.5693855195583438e+188, 1.1138771039116688e+189, 2.2277542078233375e+189, 4.455508415646675e+189, 8.91101683129335e+189, 1.78220336625867e+190, 3.56440673251734e+190,
+7.12881346503468e+190, 1.425762693006936e+191, 2.851525386013872e+191, 5.703050772027744e+191, 1.1406101544055488e+192, 2.2812203088110976e+192, 4.5624406176221952e+192, 9.1248812352443904e+192,
+1.8249762470488781e+193, 3.6499524940977562e+193, 7.2999049881955123e+193, 1.4599809976391025e+194, 2.9199619952782049e+194, 5.8399239905564099e+194, 1.167984798111282e+195, 2.335969596222564e+195,
+4.6719391924451279e+195, 9.3438783848902558e+195, 1.8687756769780512e+196, 3.7375513539561023e+196, 7.4751027079122046e+196, 1.4950205415824409e+197, 2.9900410831648819e+197, 5.9800821663297637e+197,
+1.1960164332659527e+198, 2.3920328665319055e+198, 4.784065733063811e+198, 9.5681314661276219e+198, 1.9136262932255244e+199, 3.8272525864510488e+199, 7.6545051729020976e+199, 1.5309010345804195e+200,
+3.061802069160839e+200, 6.123604138321678e+200, 1.2247208276643356e+201, 2.4494416553286712e+201, 4.8988833106573424e+201, 9.7977666213146849e+201, 1.959553324262937e+202, 3.9191066485258739e+202,
+7.8382132970517479e+202, 1.5676426594103496e+203, 3.1352853188206992e+203, 6.2705706376413983e+203, 1.2541141275282797e+204, 2.5082282550565593e+204, 5.0164565101131187e+204, 1.0032913020226237e+205,
+2.0065826040452475e+205, 4.0131652080904949e+205, 8.0263304161809898e+205, 1.605266083236198e+206, 3.2105321664723959e+206, 6.4210643329447919e+206, 1.2842128665889584e+207, 2.5684257331779168e+207,
+5.1368514663558335e+207, 1.0273702932711667e+208, 2.0547405865423334e+208, 4.1094811730846668e+208, 8.2189623461693336e+208, 1.6437924692338667e+209, 3.2875849384677334e+209, 6.5751698769354669e+209,
+1.3150339753870934e+210, 2.6300679507741868e+210, 5.2601359015483735e+210, 1.0520271803096747e+211, 2.1040543606193494e+211, 4.2081087212386988e+211, 8.4162174424773976e+211, 1.6832434884954795e+212,
+3.366486976990959e+212, 6.7329739539819181e+212, 1.3465947907963836e+213, 2.6931895815927672e+213, 5.3863791631855345e+213, 1.0772758326371069e+214, 2.1545516652742138e+214, 4.3091033305484276e+214,
+8.6182066610968552e+214, 1.723641332219371e+215, 3.4472826644387421e+215, 6.8945653288774841e+215, 1.3789130657754968e+216, 2.7578261315509936e+216, 5.5156522631019873e+216, 1.1031304526203975e+217,
+2.2062609052407949e+217, 4.4125218104815898e+217, 8.8250436209631797e+217, 1.7650087241926359e+218, 3.5300174483852719e+218, 7.0600348967705437e+218, 1.4120069793541087e+219, 2.8240139587082175e+219,
+5.648027917416435e+219, 1.129605583483287e+220, 2.259211166966574e+220, 4.518422333933148e+220, 9.036844667866296e+220, 1.8073689335732592e+221, 3.6147378671465184e+221, 7.2294757342930368e+221,
+1.4458951468586074e+222, 2.8917902937172147e+222, 5.7835805874344294e+222, 1.1567161174868859e+223, 2.3134322349737718e+223, 4.6268644699475435e+223, 9.2537289398950871e+223, 1.8507457879790174e+224,
+3.7014915759580348e+224, 7.4029831519160697e+224, 1.4805966303832139e+225, 2.9611932607664279e+225, 5.9223865215328557e+225, 1.1844773043065711e+226, 2.3689546086131423e+226, 4.7379092172262846e+226,
+9.4758184344525692e+226, 1.8951636868905138e+227, 3.7903273737810277e+227, 7.5806547475620553e+227, 1.5161309495124111e+228, 3.0322618990248221e+228, 6.0645237980496443e+228, 1.2129047596099289e+229,
+2.4258095192198577e+229, 4.8516190384397154e+229, 9.7032380768794308e+229, 1.9406476153758862e+230, 3.8812952307517723e+230, 7.7625904615035447e+230, 1.5525180923007089e+231, 3.1050361846014179e+231,
+6.2100723692028357e+231, 1.2420144738405671e+232, 2.4840289476811343e+232, 4.9680578953622686e+232, 9.9361157907245372e+232, 1.9872231581449074e+233, 3.9744463162898149e+233, 7.9488926325796297e+233,
+1.5897785265159259e+234, 3.1795570530318519e+234, 6.3591141060637038e+234, 1.2718228212127408e+235, 2.5436456424254815e+235, 5.087291284850963e+235, 1.0174582569701926e+236, 2.0349165139403852e+236,
+4.0698330278807704e+236, 8.1396660557615409e+236, 1.6279332111523082e+237, 3.2558664223046163e+237, 6.5117328446092327e+237, 1.3023465689218465e+238, 2.6046931378436931e+238, 5.2093862756873862e+238,
+1.0418772551374772e+239, 2.0837545102749545e+239, 4.1675090205499089e+239, 8.3350180410998178e+239, 1.6670036082199636e+240, 3.3340072164399271e+240, 6.6680144328798543e+240, 1.3336028865759709e+241,
+2.6672057731519417e+241, 5.3344115463038834e+241, 1.0668823092607767e+242, 2.1337646185215534e+242, 4.2675292370431067e+242, 8.5350584740862135e+242, 1.7070116948172427e+243, 3.4140233896344854e+243,
+6.8280467792689708e+243, 1.3656093558537942e+244, 2.7312187117075883e+244, 5.4624374234151766e+244, 1.0924874846830353e+245, 2.1849749693660706e+245, 4.3699499387321413e+245, 8.7398998774642826e+245,
+1.7479799754928565e+246, 3.495959950985713e+246, 6.9919199019714261e+246, 1.3983839803942852e+247, 2.7967679607885704e+247, 5.5935359215771409e+247, 1.1187071843154282e+248, 2.2374143686308563e+248,
+4.4748287372617127e+248, 8.9496574745234254e+248, 1.7899314949046851e+249, 3.5798629898093702e+249, 7.1597259796187403e+249, 1.4319451959237481e+250, 2.8638903918474961e+250, 5.7277807836949922e+250,
+1.1455561567389984e+251, 2.2911123134779969e+251, 4.5822246269559938e+251, 9.1644492539119876e+251, 1.8328898507823975e+252, 3.665779701564795e+252, 7.3315594031295901e+252, 1.466311880625918e+253,
+2.932623761251836e+253, 5.8652475225036721e+253, 1.1730495045007344e+254, 2.3460990090014688e+254, 4.6921980180029376e+254, 9.3843960360058753e+254, 1.8768792072011751e+255, 3.7537584144023501e+255,
+7.5075168288047002e+255, 1.50150336576094e+256, 3.0030067315218801e+256, 6.0060134630437602e+256, 1.201202692608752e+257, 2.4024053852175041e+257, 4.8048107704350081e+257, 9.6096215408700163e+257,
+1.9219243081740033e+258, 3.8438486163480065e+258, 7.687697232696013e+258, 1.5375394465392026e+259, 3.0750788930784052e+259, 6.1501577861568104e+259, 1.2300315572313621e+260, 2.4600631144627242e+260,
+4.9201262289254483e+260, 9.8402524578508967e+260, 1.9680504915701793e+261, 3.9361009831403587e+261, 7.8722019662807173e+261, 1.5744403932561435e+262, 3.1488807865122869e+262, 6.2977615730245739e+262,
+1.2595523146049148e+263, 2.5191046292098296e+263, 5.0382092584196591e+263, 1.0076418516839318e+264, 2.0152837033678636e+264, 4.0305674067357273e+264, 8.0611348134714546e+264, 1.6122269626942909e+265,
+3.2244539253885818e+265, 6.4489078507771637e+265, 1.2897815701554327e+266, 2.5795631403108655e+266, 5.1591262806217309e+266, 1.0318252561243462e+267, 2.0636505122486924e+267, 4.1273010244973847e+267,
+8.2546020489947695e+267, 1.6509204097989539e+268, 3.3018408195979078e+268, 6.6036816391958156e+268, 1.3207363278391631e+269, 2.6414726556783262e+269, 5.2829453113566525e+269, 1.0565890622713305e+270,
+2.113178124542661e+270, 4.226356249085322e+270, 8.4527124981706439e+270, 1.6905424996341288e+271, 3.3810849992682576e+271, 6.7621699985365152e+271, 1.352433999707303e+272, 2.7048679994146061e+272,
+5.4097359988292121e+272, 1.0819471997658424e+273, 2.1638943995316848e+273, 4.3277887990633697e+273, 8.6555775981267394e+273, 1.7311155196253479e+274, 3.4622310392506958e+274, 6.9244620785013915e+274,
+1.3848924157002783e+275, 2.7697848314005566e+275, 5.5395696628011132e+275, 1.1079139325602226e+276, 2.2158278651204453e+276, 4.4316557302408906e+276, 8.8633114604817811e+276, 1.7726622920963562e+277,
+3.5453245841927125e+277, 7.0906491683854249e+277, 1.418129833677085e+278, 2.83625966735417e+278, 5.6725193347083399e+278, 1.134503866941668e+279, 2.269007733883336e+279, 4.5380154677666719e+279,
+9.0760309355333439e+279, 1.8152061871066688e+280, 3.6304123742133376e+280, 7.2608247484266751e+280, 1.452164949685335e+281, 2.90432989937067e+281, 5.8086597987413401e+281, 1.161731959748268e+282,
+2.323463919496536e+282, 4.6469278389930721e+282, 9.2938556779861441e+282, 1.8587711355972288e+283, 3.7175422711944577e+283, 7.4350845423889153e+283, 1.4870169084777831e+284, 2.9740338169555661e+284,
+5.9480676339111323e+284, 1.1896135267822265e+285, 2.3792270535644529e+285, 4.7584541071289058e+285, 9.5169082142578116e+285, 1.9033816428515623e+286, 3.8067632857031246e+286, 7.6135265714062493e+286,
+1.5227053142812499e+287, 3.0454106285624997e+287, 6.0908212571249994e+287, 1.2181642514249999e+288, 2.4363285028499998e+288, 4.8726570056999995e+288, 9.7453140113999991e+288, 1.9490628022799998e+289,
+3.8981256045599996e+289, 7.7962512091199993e+289, 1.5592502418239999e+290, 3.1185004836479997e+290, 6.2370009672959994e+290, 1.2474001934591999e+291, 2.4948003869183998e+291, 4.9896007738367995e+291,
+9.9792015476735991e+291, 1.9958403095347198e+292, 3.9916806190694396e+292, 7.9833612381388792e+292, 1.5966722476277758e+293, 3.1933444952555517e+293, 6.3866889905111034e+293, 1.2773377981022207e+294,
+2.5546755962044414e+294, 5.1093511924088827e+294, 1.0218702384817765e+295, 2.0437404769635531e+295, 4.0874809539271062e+295, 8.1749619078542123e+295, 1.6349923815708425e+296, 3.2699847631416849e+296,
+6.5399695262833699e+296, 1.307993905256674e+297, 2.615987810513348e+297, 5.2319756210266959e+297, 1.0463951242053392e+298, 2.0927902484106784e+298, 4.1855804968213567e+298, 8.3711609936427134e+298,
+1.6742321987285427e+299, 3.3484643974570854e+299, 6.6969287949141708e+299, 1.3393857589828342e+300, 2.6787715179656683e+300, 5.3575430359313366e+300, 1.0715086071862673e+301, 2.1430172143725346e+301,
+4.2860344287450693e+301, 8.5720688574901386e+301, 1.7144137714980277e+302, 3.4288275429960554e+302, 6.8576550859921109e+302, 1.3715310171984222e+303, 2.7430620343968443e+303, 5.4861240687936887e+303,
+1.0972248137587377e+304, 2.1944496275174755e+304, 4.3888992550349509e+304, 8.7777985100699019e+304, 1.7555597020139804e+305, 3.5111194040279608e+305, 7.0222388080559215e+305, 1.4044477616111843e+306,
+2.8088955232223686e+306, 5.6177910464447372e+306, 1.1235582092889474e+307, 2.2471164185778949e+307, 4.4942328371557898e+307 };
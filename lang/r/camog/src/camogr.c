@@ -16,8 +16,14 @@
 
 #include <R.h>
 #include <Rinternals.h>
+#include <Rversion.h>
 #include <R_ext/Rdynload.h>
 
+#if R_VERSION >= R_Version(3, 6, 0)
+#define WITH_ALTREP
+#include <R_ext/Altrep.h>
+#endif
+
 #include "fastcsv.h"
 
 #include <sys/types.h>
@@ -103,13 +109,136 @@ r_fix_col_type(FastCsvResult *res, int col_idx, int col_type)
     return col_type;
 }
 
+#ifdef WITH_ALTREP
+
+/* Strings made from the fixed width parse buffer when they are used.
+   data1 is (buffer, width, nrows), and data2 is the whole STRSXP once
+   something asks for the data pointer. */
+static R_altrep_class_t camog_string_class;
+
+#define STRING_BUF(x) VECTOR_ELT(R_altrep_data1(x), 0)
+#define STRING_WIDTH(x) INTEGER(VECTOR_ELT(R_altrep_data1(x), 1))[0]
+#define STRING_NROWS(x) INTEGER(VECTOR_ELT(R_altrep_data1(x), 2))[0]
+
+static SEXP
+make_lazy_strings(SEXP buf, int width, int nrows)
+{
+    SEXP info, res;
+
+    PROTECT(info = allocVector(VECSXP, 3));
+    SET_VECTOR_ELT(info, 0, buf);
+    SET_VECTOR_ELT(info, 1, ScalarInteger(width));
+    SET_VECTOR_ELT(info, 2, ScalarInteger(nrows));
+    res = R_new_altrep(camog_string_class, info, R_NilValue);
+    UNPROTECT(1);
+
+    return res;
+}
+
+static R_xlen_t
+lazy_strings_length(SEXP x)
+{
+    return STRING_NROWS(x);
+}
+
+static SEXP
+lazy_strings_elt(SEXP x, R_xlen_t i)
+{
+    const char *p;
+    int width;
+
+    if (R_altrep_data2(x) != R_NilValue) {
+        return STRING_ELT(R_altrep_data2(x), i);
+    }
+
+    width = STRING_WIDTH(x);
+    p = (const char *)INTEGER(STRING_BUF(x)) + i * width;
+    return mkCharLen(p, strnlen(p, width));
+}
+
+static SEXP
+lazy_strings_materialize(SEXP x)
+{
+    SEXP str_vec = R_altrep_data2(x);
+    R_xlen_t i, nrows;
+
+    if (str_vec == R_NilValue) {
+        nrows = STRING_NROWS(x);
+        PROTECT(str_vec = allocVector(STRSXP, nrows));
+        for (i = 0; i < nrows; i++) {
+            SET_STRING_ELT(str_vec, i, lazy_strings_elt(x, i));
+        }
+        R_set_altrep_data2(x, str_vec);
+        UNPROTECT(1);
+    }
+
+    return str_vec;
+}
+
+static void *
+lazy_strings_dataptr(SEXP x, Rboolean writeable)
+{
+    return DATAPTR(lazy_strings_materialize(x));
+}
+
+static const void *
+lazy_strings_dataptr_or_null(SEXP x)
+{
+    SEXP str_vec = R_altrep_data2(x);
+
+    return (str_vec == R_NilValue) ? NULL : DATAPTR(str_vec);
+}
+
+static void
+lazy_strings_set_elt(SEXP x, R_xlen_t i, SEXP v)
+{
+    SET_STRING_ELT(lazy_strings_materialize(x), i, v);
+}
+
+/* Saved as an ordinary character vector. */
+static SEXP
+lazy_strings_serialized_state(SEXP x)
+{
+    return lazy_strings_materialize(x);
+}
+
+static SEXP
+lazy_strings_unserialize(SEXP cls, SEXP state)
+{
+    return state;
+}
+
+static Rboolean
+lazy_strings_inspect(SEXP x, int pre, int deep, int pvec,
+                     void (*inspect_subtree)(SEXP, int, int, int))
+{
+    Rprintf("camog_string (len=%d, width=%d, materialized=%s)\n", STRING_NROWS(x),
+            STRING_WIDTH(x), (R_altrep_data2(x) != R_NilValue) ? "T" : "F");
+    return TRUE;
+}
+
+static void
+init_lazy_strings(DllInfo *info)
+{
+    camog_string_class = R_make_altstring_class("camog_string", "camogrc", info);
+    R_set_altrep_Length_method(camog_string_class, lazy_strings_length);
+    R_set_altrep_Inspect_method(camog_string_class, lazy_strings_inspect);
+    R_set_altrep_Serialized_state_method(camog_string_class, lazy_strings_serialized_state);
+    R_set_altrep_Unserialize_method(camog_string_class, lazy_strings_unserialize);
+    R_set_altvec_Dataptr_method(camog_string_class, lazy_strings_dataptr);
+    R_set_altvec_Dataptr_or_null_method(camog_string_class, lazy_strings_dataptr_or_null);
+    R_set_altstring_Elt_method(camog_string_class, lazy_strings_elt);
+    R_set_altstring_Set_elt_method(camog_string_class, lazy_strings_set_elt);
+}
+
+#endif  /* WITH_ALTREP */
+
 static SEXP
 convert_to_frame(RFastCsvResult *res)
 {
     SEXP frame, cls, names, rownames;
-    int col_idx, ncols, header_idx, nheaders, i;
+    int col_idx, ncols, header_idx, nheaders;
     SEXP cons;
-    char rowname[20];
 
     ncols = length(CDR(res->headers_cols));
 
@@ -125,6 +254,10 @@ convert_to_frame(RFastCsvResult *res)
         tuple = CDR(tuple);
         vec = CAR(tuple);
         if (nrows >= 0 && width >= 0) {
+#ifdef WITH_ALTREP
+            /* numeric columns are parsed in place already */
+            SET_VECTOR_ELT(frame, col_idx, make_lazy_strings(vec, width, nrows));
+#else
             SEXP str_vec;
             const char *p;
             int i;
@@ -136,6 +269,7 @@ convert_to_frame(RFastCsvResult *res)
             }
             SET_VECTOR_ELT(frame, col_idx, str_vec);
             UNPROTECT(1);
+#endif
         } else {
             SET_VECTOR_ELT(frame, col_idx, vec);
         }
@@ -156,11 +290,9 @@ convert_to_frame(RFastCsvResult *res)
     }
     namesgets(frame, names);
 
-    PROTECT(rownames = allocVector(STRSXP, res->nrows));  /* row names */
-    for (i = 0; i < res->nrows; i++) {
-        sprintf(rowname, "%d", i);
-        SET_STRING_ELT(rownames, i, mkChar(rowname));
-    }
+    PROTECT(rownames = allocVector(INTSXP, 2));  /* compact row names, 1:nrows */
+    INTEGER(rownames)[0] = NA_INTEGER;
+    INTEGER(rownames)[1] = -res->nrows;
     setAttrib(frame, R_RowNamesSymbol, rownames);
 
     UNPROTECT(4);
@@ -185,6 +317,9 @@ r_parse_csv(const uchar *csv_buf, size_t buf_len, uchar sep, int nthreads,
     result.r.add_header = &r_add_header;
     result.r.add_column = &r_add_column;
     result.r.fix_column_type = &r_fix_col_type;
+    result.r.add_validity = NULL;
+    result.r.fix_decimal_scale = NULL;
+    result.r.add_mapped_column = NULL;
 
     PROTECT(result.headers_cols = CONS(R_NilValue, R_NilValue));
     result.last_header = NULL;
@@ -244,6 +379,9 @@ void
 R_init_camogrc(DllInfo *info)
 {
     R_registerRoutines(info, c_methods, call_methods, NULL, NULL);
+#ifdef WITH_ALTREP
+    init_lazy_strings(info);
+#endif
     R_useDynamicSymbols(info, FALSE);
     R_forceSymbols(info, TRUE);
 }
@@ -19,14 +19,28 @@
 #else
 #include <stdint.h>
 #include <pthread.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
 #endif
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <errno.h>
 #include <string.h>
 #include <limits.h>
 #include <math.h>
 
+#if defined(__SSE2__) && defined(__GNUC__)
+#include <emmintrin.h>
+#define HAVE_SSE2 1
+#endif
+
+#if defined(_MSC_VER) && !defined(__cplusplus)
+#define inline __inline
+#endif
+
 #include "fastcsv.h"
 #include "fastcsv_todouble.h"
 #include "mtq.h"
@@ -57,9 +71,51 @@ typedef struct {
     width_t width;
     int first_row;
     int type;
+    int out_type;  /* type of arr_ptr, after resolve_columns */
+    int has_expo;  /* a cell had an exponent */
+    int frac_digits;  /* most digits after a decimal point */
+    int scale;  /* COL_TYPE_DECIMAL */
+    width_t spill_size;  /* bytes per row if mapped from a file, else 0 */
+    size_t nquoted;  /* cells that open with a quote */
     uchar *arr_ptr;
 } Column;
 
+#define HLL_BITS 12
+#define HLL_SIZE (1 << HLL_BITS)
+
+/* Per chunk accumulators for FastCsvSummary */
+typedef struct {
+    size_t count;
+    size_t nulls;
+    size_t nans;
+    int64_t int_min;
+    int64_t int_max;
+    int64_t int_sum;
+    double float_min;
+    double float_max;
+    double float_sum;
+    uchar hll[HLL_SIZE];
+} ColumnAcc;
+
+typedef union {
+    int64_t i;
+    double d;
+} AggSlot;
+
+/* Hash table of group keys for aggregates.  An entry is a slot for each
+   aggregate, the number of non-null cells in each slot, then the key
+   padded to 8 bytes. */
+typedef struct {
+    size_t key_space;
+    int nslots;
+    size_t entry_size;
+    size_t nentries;
+    size_t entries_space;
+    uchar *entries;  /* in order of first appearance */
+    size_t nbuckets;  /* power of 2 */
+    size_t *buckets;  /* entry index + 1, or 0 if empty */
+} AggTable;
+
 typedef struct {
     int chunk_idx;
     const uchar *buf;
@@ -70,12 +126,23 @@ typedef struct {
     LinkedBuf offset_buf;
     int ncols;
     int nrows;
+    uchar *keep;  /* per row, NULL if not filtered */
+    int nkeep;
+    AggTable *agg_table;
+    ColumnAcc *col_accs;  /* if summarizing */
+    uchar **null_bits;  /* per column, bit set for each null kept row, NULL if none */
+    unsigned short *parts;  /* partition of each kept row, NULL if not partitioned */
+    int *part_out;  /* per partition, out_idx of the next row */
+    int *part_end;  /* per partition, out_idx after the chunk's last row */
 } Chunk;
 
 typedef struct {
     int nchunks;
     Chunk *all_chunks;
-    Chunk *bigchunk;  /* for quoted string fixup */
+    int nbufs;
+    const FastCsvInput *inputs;  /* nbufs */
+    int *buf_chunks;  /* index of first chunk of each buffer, nbufs + 1 entries */
+    Chunk **bigchunks;  /* for quoted string fixup, one per buffer */
     int flags;
     int *str_idxs;
     int n_str_cols;
@@ -83,12 +150,45 @@ typedef struct {
     uchar sep;
     int64_t missing_int_val;
     double missing_float_val;
+    FastCsvStats *stats;
+    double t0;
+    FastCsvFilter *filter;
+    int filter_ncols;  /* columns the filter looks at */
+    FastCsvAggregate *aggregate;
+    int agg_ncols;  /* columns the aggregate looks at */
+    FastCsvPartition *partition;
+    size_t agg_key_space;
+    int *agg_slot_types;  /* COL_TYPE_INT64 or COL_TYPE_DOUBLE */
+    FastCsvSummary *summary;
+    int n_na_tokens;
+    const FastCsvValue *na_tokens;
+    int narrow;
+    int fill_col;  /* stage 5 */
+    size_t memory_limit;
+    const char *spill_dir;
+    int nthreads;
+    int release_rows;  /* rows to fill between releasing mapped columns, 0 if none */
+    int fill_kernel;  /* index in fill_kernels, or -1 for fill_arrays */
+    int schema_ncols;
+    const FastCsvSchemaColumn *schema;
+    int schema_widths;  /* a string column of the schema has width 0 */
 } ThreadCommon;
 
+/* Rows formatted by one write_csv job */
+typedef struct {
+    const FastCsvOutput *output;
+    size_t begin_row;
+    size_t end_row;
+    uchar *buf;
+    size_t len;
+} WriteChunk;
+
 typedef struct {
-    int stage;
+    int stage;  /* 1: parse_stage1, 2: fill_arrays or aggregate_rows, 3: filter_rows
+                   and partition_rows, 4: format_rows, 5: fill_column */
     Chunk *chunk;
     ThreadCommon *common;
+    WriteChunk *write_chunk;  /* stage 4 */
 } ThreadData;
 
 typedef struct {
@@ -102,12 +202,38 @@ typedef struct {
     JobQueue outqueue;
 } Reader;
 
+typedef struct {
+    Reader *reader;
+    int thread_idx;
+} Worker;
+
 static Reader reader = {0};
 
+struct fast_csv_table_s {
+    ThreadCommon common;
+    ThreadData *thread_datas;
+    int nthreads;
+    const uchar *csv_buf;
+};
+
 #define MAXLINE 256
 
 #define CHUNK_COLUMN(C, I) ((Column *)((C)->columns.data))[I]
 
+#define AGG_ENTRY(T, I) ((T)->entries + (I) * (T)->entry_size)
+#define AGG_ENTRY_SLOTS(E) ((AggSlot *)(E))
+#define AGG_ENTRY_COUNTS(T, E) ((int64_t *)((E) + (T)->nslots * sizeof(AggSlot)))
+#define AGG_ENTRY_KEY(T, E) ((E) + (T)->nslots * (sizeof(AggSlot) + sizeof(int64_t)))
+
+#define CHUNK_STATS(T, C) (&(T)->stats->chunks[(C) - (T)->all_chunks])
+
+#define STATS_TIME(T, F)                                \
+    do {                                                \
+        if ((T)->stats != NULL) {                       \
+            (T)->stats->F = clock_now() - (T)->t0;      \
+        }                                               \
+    } while (0)
+
 #define NEXTCHAR_NOQUOTES(L) \
     do {                     \
         ++p;                 \
@@ -179,8 +305,26 @@ static Reader reader = {0};
         (C)->width = 0;                         \
         (C)->first_row = R;                     \
         (C)->type = T;                          \
+        (C)->has_expo = 0;                      \
+        (C)->frac_digits = 0;                   \
+        (C)->nquoted = 0;                       \
     } while (0)
 
+static double
+clock_now(void)
+{
+#ifdef _WIN32
+    LARGE_INTEGER count, freq;
+    QueryPerformanceCounter(&count);
+    QueryPerformanceFrequency(&freq);
+    return (double)count.QuadPart / (double)freq.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+#endif
+}
+
 int
 array_buf_init(ArrayBuf *arr_buf)
 {
@@ -222,14 +366,583 @@ linked_free(LinkedBuf *linked) {
     return 0;
 }
 
+static void
+agg_table_init(AggTable *table, size_t key_space, int nslots)
+{
+    table->key_space = key_space;
+    table->nslots = nslots;
+    table->entry_size = nslots * (sizeof(AggSlot) + sizeof(int64_t)) + key_space;
+    table->nentries = 0;
+    table->entries_space = 16;
+    table->entries = (uchar *)malloc(table->entries_space * table->entry_size);
+    table->nbuckets = 32;
+    table->buckets = (size_t *)calloc(table->nbuckets, sizeof(size_t));
+}
+
+static void
+agg_table_free(AggTable *table)
+{
+    free(table->entries);
+    free(table->buckets);
+}
+
+static uint64_t
+agg_hash(const uchar *key, size_t len)
+{
+    uint64_t h = 0;
+    size_t i;
+
+    for (i = 0; i < len; i += sizeof(uint64_t)) {
+        uint64_t word;
+        memcpy(&word, key + i, sizeof(uint64_t));
+        h = (h ^ word) * 0x9e3779b97f4a7c15ULL;
+        h ^= h >> 29;
+    }
+
+    return h;
+}
+
+static size_t
+agg_table_bucket(const AggTable *table, const uchar *key)
+{
+    size_t mask = table->nbuckets - 1;
+    size_t b = agg_hash(key, table->key_space) & mask;
+
+    while (table->buckets[b] != 0) {
+        const uchar *entry = AGG_ENTRY(table, table->buckets[b] - 1);
+        if (memcmp(AGG_ENTRY_KEY(table, entry), key, table->key_space) == 0) {
+            break;
+        }
+        b = (b + 1) & mask;
+    }
+
+    return b;
+}
+
+/* Finds the entry for the key, adding a zeroed one if there is none. */
+static uchar *
+agg_table_entry(AggTable *table, const uchar *key)
+{
+    size_t b = agg_table_bucket(table, key);
+    uchar *entry;
+    size_t i;
+
+    if (table->buckets[b] != 0) {
+        return AGG_ENTRY(table, table->buckets[b] - 1);
+    }
+
+    if (table->nentries >= table->entries_space) {
+        table->entries_space *= 2;
+        table->entries = (uchar *)realloc(table->entries,
+                                          table->entries_space * table->entry_size);
+    }
+    entry = AGG_ENTRY(table, table->nentries);
+    memset(entry, 0, table->entry_size);
+    memcpy(AGG_ENTRY_KEY(table, entry), key, table->key_space);
+    table->buckets[b] = ++table->nentries;
+
+    if (table->nentries * 2 > table->nbuckets) {
+        free(table->buckets);
+        table->nbuckets *= 2;
+        table->buckets = (size_t *)calloc(table->nbuckets, sizeof(size_t));
+        for (i = 0; i < table->nentries; i++) {
+            b = agg_table_bucket(table, AGG_ENTRY_KEY(table, AGG_ENTRY(table, i)));
+            table->buckets[b] = i + 1;
+        }
+    }
+
+    return entry;
+}
+
 static int
 chunk_free(Chunk *chunk) {
     linked_free(&chunk->offset_buf);
     array_buf_free(&chunk->columns);
+    free(chunk->keep);
+    free(chunk->parts);
+    free(chunk->part_out);
+    free(chunk->part_end);
+    free(chunk->col_accs);
+    if (chunk->null_bits != NULL) {
+        int col_idx;
+        for (col_idx = 0; col_idx < chunk->ncols; col_idx++) {
+            free(chunk->null_bits[col_idx]);
+        }
+        free(chunk->null_bits);
+    }
+    if (chunk->agg_table != NULL) {
+        agg_table_free(chunk->agg_table);
+        free(chunk->agg_table);
+    }
+
+    return 0;
+}
+
+static uint64_t
+hash_mix(uint64_t h)
+{
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+static void
+hll_add(uchar *hll, uint64_t h)
+{
+    uint64_t w = (h << HLL_BITS) | ((uint64_t)1 << (HLL_BITS - 1));
+    uchar rank = 1;
+
+    while (!(w >> 63)) {
+        rank++;
+        w <<= 1;
+    }
+    if (rank > hll[h >> (64 - HLL_BITS)]) {
+        hll[h >> (64 - HLL_BITS)] = rank;
+    }
+}
+
+static double
+hll_estimate(const uchar *hll)
+{
+    double m = HLL_SIZE;
+    double sum = 0.0;
+    double est;
+    int zeros = 0;
+    int i;
+
+    for (i = 0; i < HLL_SIZE; i++) {
+        sum += ldexp(1.0, -hll[i]);
+        if (hll[i] == 0) {
+            zeros++;
+        }
+    }
+
+    est = 0.7213 / (1.0 + 1.079 / m) * m * m / sum;
+    if (est <= 2.5 * m && zeros > 0) {
+        est = m * log(m / zeros);  /* linear counting for small sets */
+    }
+
+    return est;
+}
+
+static void
+acc_int(ColumnAcc *acc, int64_t value)
+{
+    if (acc->count == 0 || value < acc->int_min) {
+        acc->int_min = value;
+    }
+    if (acc->count == 0 || value > acc->int_max) {
+        acc->int_max = value;
+    }
+    acc->int_sum += value;
+    acc->count++;
+    hll_add(acc->hll, hash_mix((uint64_t)value));
+}
+
+static void
+acc_float(ColumnAcc *acc, double val)
+{
+    uint64_t bits;
+
+    if (val != val) {
+        acc->nans++;
+        return;
+    }
+    if (acc->count == 0 || val < acc->float_min) {
+        acc->float_min = val;
+    }
+    if (acc->count == 0 || val > acc->float_max) {
+        acc->float_max = val;
+    }
+    acc->float_sum += val;
+    acc->count++;
+    if (val == 0.0) {
+        val = 0.0;  /* not -0.0 */
+    }
+    memcpy(&bits, &val, sizeof(double));
+    hll_add(acc->hll, hash_mix(bits));
+}
+
+static void
+acc_string(ColumnAcc *acc, const uchar *str, size_t len)
+{
+    uint64_t h = 14695981039346656037ULL;  /* FNV-1a */
+    size_t i;
+
+    if (len == 0) {
+        acc->nulls++;
+        return;
+    }
+    for (i = 0; i < len; i++) {
+        h = (h ^ str[i]) * 1099511628211ULL;
+    }
+    acc->count++;
+    hll_add(acc->hll, hash_mix(h));
+}
+
+/* Whether the text from p to end, less a trailing \r, is an NA token. */
+static int
+is_na_token(const ThreadCommon *common, const uchar *p, const uchar *end)
+{
+    int i;
+
+    if (end > p && end[-1] == '\r') {
+        end--;
+    }
+    for (i = 0; i < common->n_na_tokens; i++) {
+        const FastCsvValue *token = &common->na_tokens[i];
+        if (token->len == (size_t)(end - p) && memcmp(token->str, p, token->len) == 0) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+static size_t
+col_type_size(int out_type)
+{
+    switch (out_type) {
+    case COL_TYPE_INT8:
+        return sizeof(int8_t);
+    case COL_TYPE_INT16:
+        return sizeof(int16_t);
+    case COL_TYPE_INT32:
+    case COL_TYPE_FLOAT32:
+        return sizeof(int32_t);
+    default:
+        return sizeof(int64_t);
+    }
+}
+
+/* Returns the value as stored in the column's output type. */
+static int64_t
+store_int(const Column *column, int out_idx, int64_t value)
+{
+    switch (column->out_type) {
+    case COL_TYPE_INT8:
+        return ((int8_t *)column->arr_ptr)[out_idx] = (int8_t)value;
+    case COL_TYPE_INT16:
+        return ((int16_t *)column->arr_ptr)[out_idx] = (int16_t)value;
+    case COL_TYPE_INT32:
+        return ((int32_t *)column->arr_ptr)[out_idx] = (int32_t)value;
+    default:
+        return ((int64_t *)column->arr_ptr)[out_idx] = value;
+    }
+}
+
+static double
+store_float(const Column *column, int out_idx, double val)
+{
+    if (column->out_type == COL_TYPE_FLOAT32) {
+        return ((float *)column->arr_ptr)[out_idx] = (float)val;
+    }
+    return ((double *)column->arr_ptr)[out_idx] = val;
+}
+
+/* The first '"' or '\r' from p, else end.  Quoted cells only stop at
+   these, so long text is scanned 32 bytes at a time. */
+static const uchar *
+find_quote(const uchar *p, const uchar *end)
+{
+#ifdef HAVE_SSE2
+    const __m128i quotes = _mm_set1_epi8('"');
+    const __m128i crs = _mm_set1_epi8('\r');
+
+    while (end - p >= 32) {
+        __m128i lo = _mm_loadu_si128((const __m128i *)p);
+        __m128i hi = _mm_loadu_si128((const __m128i *)(p + 16));
+        unsigned int mask = (unsigned int)_mm_movemask_epi8(
+            _mm_or_si128(_mm_cmpeq_epi8(lo, quotes), _mm_cmpeq_epi8(lo, crs)))
+            | ((unsigned int)_mm_movemask_epi8(
+                   _mm_or_si128(_mm_cmpeq_epi8(hi, quotes), _mm_cmpeq_epi8(hi, crs))) << 16);
+        if (mask != 0) {
+            return p + __builtin_ctz(mask);
+        }
+        p += 32;
+    }
+#endif
+
+    while (p < end && *p != '"' && *p != '\r') {
+        ++p;
+    }
+    return p;
+}
+
+/* The first sep, '\n' or '\r' from p, else end. */
+static const uchar *
+find_cell_end(const uchar *p, const uchar *end, uchar sep)
+{
+#ifdef HAVE_SSE2
+    const __m128i seps = _mm_set1_epi8((char)sep);
+    const __m128i newlines = _mm_set1_epi8('\n');
+    const __m128i crs = _mm_set1_epi8('\r');
+
+    while (end - p >= 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)p);
+        int mask = _mm_movemask_epi8(_mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, seps),
+                                                               _mm_cmpeq_epi8(v, newlines)),
+                                                  _mm_cmpeq_epi8(v, crs)));
+        if (mask != 0) {
+            return p + __builtin_ctz(mask);
+        }
+        p += 16;
+    }
+#endif
+
+    while (p < end && *p != sep && *p != '\n' && *p != '\r') {
+        ++p;
+    }
+    return p;
+}
+
+/* The newline ending the row that begins at p, else end.  As in
+   parse_stage1, a quote only opens a quoted cell at the start of a
+   cell. */
+static const uchar *
+find_row_end(const uchar *p, const uchar *end, uchar sep)
+{
+    const uchar *row = p;
+#ifdef HAVE_SSE2
+    const __m128i newlines = _mm_set1_epi8('\n');
+    const __m128i quotes = _mm_set1_epi8('"');
+#endif
+
+    while (1) {
+#ifdef HAVE_SSE2
+        while (end - p >= 16) {
+            __m128i v = _mm_loadu_si128((const __m128i *)p);
+            int mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(v, newlines),
+                                                      _mm_cmpeq_epi8(v, quotes)));
+            if (mask != 0) {
+                p += __builtin_ctz(mask);
+                break;
+            }
+            p += 16;
+        }
+#endif
+        while (p < end && *p != '\n' && *p != '"') {
+            ++p;
+        }
+        if (p >= end || *p == '\n') {
+            return p;
+        }
+        if (p == row || p[-1] == sep) {
+            while (1) {
+                p = find_quote(p + 1, end);
+                if (p >= end) {
+                    return p;
+                }
+                if (*p == '"') {
+                    if (p + 1 < end && p[1] == '"') {
+                        ++p;  /* "" is a quote */
+                    } else {
+                        break;
+                    }
+                }
+            }
+        }
+        ++p;
+    }
+}
+
+static const int64_t ipowers10[] = {
+    1LL, 10LL, 100LL, 1000LL, 10000LL, 100000LL, 1000000LL, 10000000LL, 100000000LL,
+    1000000000LL, 10000000000LL, 100000000000LL, 1000000000000LL, 10000000000000LL,
+    100000000000000LL, 1000000000000000LL, 10000000000000000LL, 100000000000000000LL,
+    1000000000000000000LL
+};
+
+/* value * 10 ** expo, rounded half away from zero.  Returns -1 if it
+   does not fit. */
+static int
+scale_decimal(int64_t value, int expo, int64_t *res)
+{
+    int64_t d, r;
+
+    if (value == 0) {
+        *res = 0;
+        return 0;
+    }
+
+    if (expo >= 0) {
+        if (expo > DECIMAL_MAX_SCALE) {
+            return -1;
+        }
+        d = ipowers10[expo];
+        if (value > LLONG_MAX / d || value < LLONG_MIN / d) {
+            return -1;
+        }
+        *res = value * d;
+        return 0;
+    }
+
+    if (expo < -DECIMAL_MAX_SCALE) {
+        /* |value| < 10 ** 19, so it rounds to -1, 0 or 1 */
+        *res = 0;
+        if (expo == -DECIMAL_MAX_SCALE - 1) {
+            if (value >= 5 * ipowers10[18]) {
+                *res = 1;
+            } else if (value <= -5 * ipowers10[18]) {
+                *res = -1;
+            }
+        }
+        return 0;
+    }
 
+    d = ipowers10[-expo];
+    *res = value / d;
+    r = value % d;
+    if (r >= d - r) {
+        ++*res;
+    } else if (-r >= d + r) {
+        --*res;
+    }
     return 0;
 }
 
+static void
+mark_null(Chunk *chunk, int col_idx, int out_idx)
+{
+    uchar *bits = chunk->null_bits[col_idx];
+
+    if (bits == NULL) {
+        bits = (uchar *)calloc((chunk->nkeep + 7) / 8, 1);
+        chunk->null_bits[col_idx] = bits;
+    }
+    bits[out_idx >> 3] |= 1 << (out_idx & 7);
+}
+
+/* The double of a number parsed by parser2.h that is not null, rounded
+   once to float if is_float32. */
+static inline double
+parsed_double(int64_t value, int expo, int fracexpo, int exposign, int is_float32)
+{
+    int sign;
+    double val;
+
+    if (expo == INT_MIN) {
+        return NAN;
+    }
+    if (expo == INT_MAX) {
+        return (value >= 0) ? INFINITY : -INFINITY;
+    }
+    if (value == 0) {
+        return 0.0;
+    }
+
+    expo = expo * exposign - fracexpo;
+    if (value > 0) {
+        sign = 1;
+    } else {
+        sign = -1;
+        value = -value;
+    }
+    if (is_float32) {
+        float fval;
+        FASTCSV_TOFLOAT(sign, value, expo, fval);
+        val = fval;
+    } else {
+        FASTCSV_TODOUBLE(sign, value, expo, val);
+    }
+    return val;
+}
+
+/* Store a number parsed by parser2.h, converted for the column's type.
+   is_null for an empty cell or NA token. */
+static inline void
+store_number(ThreadCommon *common, Chunk *chunk, int col_idx, int out_idx, int is_null,
+             int64_t value, int expo, int fracexpo, int exposign)
+{
+    Column *column = &CHUNK_COLUMN(chunk, col_idx);
+    ColumnAcc *accs = chunk->col_accs;
+    double val;
+
+    if (is_null && chunk->null_bits != NULL) {
+        mark_null(chunk, col_idx, out_idx);
+    }
+
+    if (column->type != COL_TYPE_DOUBLE) {
+        if (is_null || fracexpo != 0) {
+            store_int(column, out_idx, common->missing_int_val);
+            if (accs != NULL) {
+                accs[col_idx].nulls++;
+            }
+            if (!is_null && chunk->null_bits != NULL) {
+                mark_null(chunk, col_idx, out_idx);
+            }
+        } else {
+            value = store_int(column, out_idx, value);
+            if (accs != NULL) {
+                acc_int(&accs[col_idx], value);
+            }
+        }
+    } else if (column->out_type == COL_TYPE_DECIMAL) {
+        if (is_null || expo == INT_MIN || expo == INT_MAX
+            || scale_decimal(value, column->scale + expo * exposign - fracexpo,
+                             &value) != 0) {
+            store_int(column, out_idx, common->missing_int_val);
+            if (accs != NULL) {
+                accs[col_idx].nulls++;
+            }
+            if (!is_null && chunk->null_bits != NULL) {
+                mark_null(chunk, col_idx, out_idx);
+            }
+        } else {
+            store_int(column, out_idx, value);
+            if (accs != NULL) {
+                acc_int(&accs[col_idx], value);
+            }
+        }
+    } else {
+        val = is_null ? common->missing_float_val
+            : parsed_double(value, expo, fracexpo, exposign,
+                            column->out_type == COL_TYPE_FLOAT32);
+
+        val = store_float(column, out_idx, val);
+
+        if (accs != NULL) {
+            if (is_null) {
+                accs[col_idx].nulls++;
+            } else {
+                acc_float(&accs[col_idx], val);
+            }
+        }
+    }
+}
+
+/* Write back rows begin to end of the mapped columns, and drop them from
+   memory.  Pages of a shared file mapping are safe to drop even if another
+   chunk is still filling them; they are read back on the next touch. */
+static void
+release_rows(Chunk *chunk, int begin, int end)
+{
+#ifndef _WIN32
+    uintptr_t page_mask = (uintptr_t)sysconf(_SC_PAGESIZE) - 1;
+    int col_idx;
+
+    for (col_idx = 0; col_idx < chunk->ncols; col_idx++) {
+        Column *column = &CHUNK_COLUMN(chunk, col_idx);
+        uintptr_t p, q;
+        if (column->spill_size == 0) {
+            continue;
+        }
+        p = (uintptr_t)(column->arr_ptr + begin * column->spill_size) & ~page_mask;
+        q = (uintptr_t)(column->arr_ptr + end * column->spill_size) & ~page_mask;
+        if (end == chunk->nkeep) {
+            q = (uintptr_t)(column->arr_ptr + end * column->spill_size + page_mask) & ~page_mask;
+        }
+        if (q > p) {
+            msync((void *)p, q - p, MS_ASYNC);
+            madvise((void *)p, q - p, MADV_DONTNEED);
+        }
+    }
+#endif
+}
+
 static int
 fill_arrays(ThreadCommon *common, Chunk *chunk)
 {
@@ -237,38 +950,88 @@ fill_arrays(ThreadCommon *common, Chunk *chunk)
     const uchar *buf_end;
     int col_idx;
     int row_idx;
+    int out_idx;  /* differs from row_idx if filtered or partitioned */
+    int out_end;  /* after the last row of the chunk, or of the row's partition */
+    int row_stop;  /* at which to release mapped columns, else nrows */
+    int released = 0;
+    LinkedLink *offset_link = chunk->offset_buf.first;
+    uchar *offset_ptr = chunk->offset_buf.first_data;
+    ColumnAcc *accs = NULL;
     const uchar sep = common->sep;
+#ifdef HAVE_SSE2
+    const __m128i seps = _mm_set1_epi8((char)sep);
+    const __m128i newlines = _mm_set1_epi8('\n');
+    const __m128i crs = _mm_set1_epi8('\r');
+#endif
 
     if (chunk->nrows == 0) {
         return 0;
     }
 
+    if (common->summary != NULL) {
+        accs = (ColumnAcc *)calloc(chunk->ncols, sizeof(ColumnAcc));
+        chunk->col_accs = accs;
+    }
+    if (common->result->add_validity != NULL && common->partition == NULL) {
+        chunk->null_bits = (uchar **)calloc(chunk->ncols, sizeof(uchar *));
+    }
+
     buf_end = chunk->buf_end;
     p = chunk->buf;
-    row_idx = 0;
+    out_idx = 0;
+    out_end = chunk->nkeep;
     col_idx = 0;
-    for (row_idx = 0; row_idx < chunk->nrows; ) {
+    row_idx = 0;
+    row_stop = (common->release_rows > 0 && common->release_rows < chunk->nrows)
+        ? common->release_rows : chunk->nrows;
+ nextrows:
+    for (; row_idx < row_stop; ) {
         int nquotes = 0;
         const uchar *cellp;
         int col_type;
         uchar c;
         Column *column = &CHUNK_COLUMN(chunk, col_idx);
-        double val;
         uchar *dest, *q;
+        uchar *dest_end;  /* longer cells are cut, if widths are from a schema */
+#ifdef HAVE_SSE2
+        uchar *col_end;
+#endif
         int digit;
         int64_t value = 0;
         int expo = 0;
         int fracexpo = 0;
         int exposign = 1;
+        int is_null;
 
-        if (p >= buf_end) {
-            goto comma;
+        if (col_idx == 0 && chunk->keep != NULL) {
+            width_t row_width = *((width_t *)offset_ptr);
+            LINKED_NEXT(offset_link, offset_ptr, width_t);
+            if (!chunk->keep[row_idx]) {
+                p += row_width;
+                row_idx++;
+                continue;
+            }
+        }
+        if (col_idx == 0 && chunk->parts != NULL) {
+            out_idx = chunk->part_out[chunk->parts[row_idx]]++;
+            out_end = chunk->part_end[chunk->parts[row_idx]];
         }
 
         cellp = p;
 
         col_type = column->type;
 
+        if (p >= buf_end) {  /* empty last cell */
+            c = 0;
+            if (col_type == COL_TYPE_STRING) {
+                dest = column->arr_ptr + out_idx * column->width;
+                dest_end = dest + column->width;
+                q = dest;
+                goto atstringend;
+            }
+            goto goodend;
+        }
+
         c = *p;
 
         if (col_type == COL_TYPE_STRING) {
@@ -345,47 +1108,18 @@ fill_arrays(ThreadCommon *common, Chunk *chunk)
 
     goodend:
 
-        if (col_type == COL_TYPE_INT32) {
-            dest = column->arr_ptr + row_idx * sizeof(int32_t);
-            if (p == cellp || fracexpo != 0) {
-                value = common->missing_int_val;
-            }
-            *((int32_t *)dest) = value;
-        } else if (col_type == COL_TYPE_INT64) {
-            dest = column->arr_ptr + row_idx * sizeof(int64_t);
-            if (p == cellp || fracexpo != 0) {
-                value = common->missing_int_val;
-            }
-            *((int64_t *)dest) = value;
-        } else {
-            dest = column->arr_ptr + row_idx * sizeof(double);
-            if (p == cellp) {
-                val = common->missing_float_val;
-            } else if (expo == INT_MIN) {
-                val = NAN;
-            } else if (expo == INT_MAX) {
-                val = (value >= 0) ? INFINITY : -INFINITY;
-            } else if (value == 0) {
-                val = 0.0;
-            } else {
-                int sign;
-                expo = expo * exposign - fracexpo;
-                if (value > 0) {
-                    sign = 1;
-                } else {
-                    sign = -1;
-                    value = -value;
-                }
-                FASTCSV_TODOUBLE(sign, value, expo, val);
-            }
-
-            *((double *)dest) = val;
-        }
+        /* NA tokens that look like numbers, eg. -999 */
+        is_null = (p == cellp
+                   || (common->n_na_tokens > 0 && nquotes == 0
+                       && is_na_token(common, cellp, p)));
+        store_number(common, chunk, col_idx, out_idx, is_null, value, expo, fracexpo,
+                     exposign);
 
         goto comma;
 
     parsestring:
-        dest = column->arr_ptr + row_idx * column->width;
+        dest = column->arr_ptr + out_idx * column->width;
+        dest_end = dest + column->width;
         q = dest;
 
         if (c == '"') {
@@ -393,7 +1127,14 @@ fill_arrays(ThreadCommon *common, Chunk *chunk)
             ++cellp;
             /* c is opening quote here */
             while (1) {
-                ++p;
+                const uchar *run_end = find_quote(p + 1, buf_end);
+                size_t len = run_end - (p + 1);
+                if (len > (size_t)(dest_end - q)) {
+                    len = dest_end - q;
+                }
+                memcpy(q, p + 1, len);
+                q += len;
+                p = run_end;
                 if (p >= buf_end) {
                     goto atstringend;
                 }
@@ -411,15 +1152,42 @@ fill_arrays(ThreadCommon *common, Chunk *chunk)
                         break;
                     }
                 }
-                *q++ = c;
+                if (q < dest_end) {
+                    *q++ = c;
+                }
             }
         }
         /* c is non-quoted char here */
+#ifdef HAVE_SSE2
+        /* 16 bytes at a time while they fit in this chunk's rows of the
+           column.  Bytes stored past the cell end are overwritten by its
+           padding or by the next rows. */
+        col_end = column->arr_ptr + out_end * column->width;
+        while (buf_end - p >= 16 && col_end - q >= 16) {
+            __m128i v = _mm_loadu_si128((const __m128i *)p);
+            int mask = _mm_movemask_epi8(_mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, seps),
+                                                                   _mm_cmpeq_epi8(v, newlines)),
+                                                      _mm_cmpeq_epi8(v, crs)));
+            _mm_storeu_si128((__m128i *)q, v);
+            if (mask != 0) {
+                mask = __builtin_ctz(mask);
+                p += mask;
+                q += mask;
+                break;
+            }
+            p += 16;
+            q += 16;
+        }
+        if (p >= buf_end) {
+            goto atstringend;
+        }
+        c = *p;
+#endif
         while (1) {
             if (c == sep || c == '\n') {
                 goto atstringend;
             }
-            if (c != '\r') {
+            if (c != '\r' && q < dest_end) {
                 *q++ = c;
             }
             ++p;
@@ -429,9 +1197,21 @@ fill_arrays(ThreadCommon *common, Chunk *chunk)
             c = *p;
         }
     atstringend:
+        if (q > dest_end) {  /* from the 16 byte copies */
+            q = dest_end;
+        }
+        if (common->n_na_tokens > 0 && is_na_token(common, dest, q)) {
+            q = dest;
+        }
         if ((q - dest) < column->width) {
             memset(q, 0, column->width - (q - dest));
         }
+        if (accs != NULL) {
+            acc_string(&accs[col_idx], dest, q - dest);
+        }
+        if (q == dest && chunk->null_bits != NULL) {
+            mark_null(chunk, col_idx, out_idx);
+        }
 
     comma:
 
@@ -439,467 +1219,2351 @@ fill_arrays(ThreadCommon *common, Chunk *chunk)
             for (col_idx++; col_idx < chunk->ncols; col_idx++) {
                 Column *column = &CHUNK_COLUMN(chunk, col_idx);
                 int col_type = column->type;
-                uchar *dest;
-                if (col_type == COL_TYPE_INT32) {
-                    dest = column->arr_ptr + row_idx * sizeof(int32_t);
-                    *((int32_t *)dest) = common->missing_int_val;
-                } else if (col_type == COL_TYPE_INT64) {
-                    dest = column->arr_ptr + row_idx * sizeof(int64_t);
-                    *((int64_t *)dest) = common->missing_int_val;
-                } else if (col_type == COL_TYPE_DOUBLE) {
-                    dest = column->arr_ptr + row_idx * sizeof(double);
-                    *((double *)dest) = common->missing_float_val;
+                if (col_type == COL_TYPE_STRING) {
+                    memset(column->arr_ptr + out_idx * column->width, 0, column->width);
+                } else if (col_type == COL_TYPE_DOUBLE && column->out_type != COL_TYPE_DECIMAL) {
+                    store_float(column, out_idx, common->missing_float_val);
                 } else {
-                    dest = column->arr_ptr + row_idx * column->width;
-                    memset(dest, 0, column->width);
+                    store_int(column, out_idx, common->missing_int_val);
+                }
+                if (accs != NULL) {
+                    accs[col_idx].nulls++;
+                }
+                if (chunk->null_bits != NULL) {
+                    mark_null(chunk, col_idx, out_idx);
                 }
             }
             col_idx = 0;
             row_idx++;
-        } else {
-            col_idx++;
+            out_idx++;
+        } else if (++col_idx >= chunk->ncols) {
+            /* more cells than the schema has columns */
+            p = find_row_end(p + 1, buf_end, sep);
+            col_idx = 0;
+            row_idx++;
+            out_idx++;
         }
         p++;
     }
 
+    if (common->release_rows > 0) {
+        release_rows(chunk, released, out_idx);
+        released = out_idx;
+        if (row_stop < chunk->nrows) {
+            row_stop = (chunk->nrows - row_stop > common->release_rows)
+                ? row_stop + common->release_rows : chunk->nrows;
+            goto nextrows;
+        }
+    }
+
+    if (common->stats != NULL) {
+        CHUNK_STATS(common, chunk)->nbytes = p - chunk->buf;
+        CHUNK_STATS(common, chunk)->nrows = chunk->nrows;
+    }
+
     return 0;
 }
 
+/* Unordered comparison, when either side is a NaN. */
+#define FILTER_UNORDERED 2
+
+/* Returns the end of the cell, at a separator, newline or buf_end. */
+static const uchar *
+skip_cell(const uchar *p, const uchar *buf_end, uchar sep)
+{
+    if (p < buf_end && *p == '"') {
+        while (1) {
+            p = find_quote(p + 1, buf_end);
+            if (p >= buf_end) {
+                return p;
+            }
+            if (*p == '"') {
+                ++p;
+                if (p >= buf_end) {
+                    return p;
+                }
+                if (*p != '"') {
+                    break;
+                }
+            }
+        }
+    }
+    while (p < buf_end && *p != sep && *p != '\n') {
+        ++p;
+    }
+    return p;
+}
+
+/* fill_arrays for numeric schemas, without filters, summaries, validity
+   or NA tokens. */
+typedef struct {
+    const char *types;  /* 'i' int64 or 'd' double, repeated across the columns */
+    int (*fill)(ThreadCommon *common, Chunk *chunk);
+} FillKernel;
+
+#include "fill_kernels.h"
+
+/* Index of the kernel for the columns, or -1. */
 static int
-allocate_arrays(ThreadCommon *common)
+select_fill_kernel(ThreadCommon *common)
 {
-    Chunk *chunks = common->all_chunks;
-    int nchunks = common->nchunks;
+    const Chunk *chunk = &common->all_chunks[0];
     int i;
     int col_idx;
-    int ncols = 0;
-    int nrows = 0;
-    int n_str_cols = 0;
 
-    for (i = 0; i < nchunks; i++) {
-        if (chunks[i].ncols > ncols) {
-            ncols = chunks[i].ncols;
+    if (common->nchunks == 0 || chunk->ncols == 0 || common->filter != NULL
+        || common->partition != NULL || common->summary != NULL || common->result->add_validity != NULL
+        || common->n_na_tokens > 0 || common->release_rows > 0) {
+        return -1;
+    }
+
+    for (i = 0; fill_kernels[i].types != NULL; i++) {
+        const char *types = fill_kernels[i].types;
+        int ntypes = strlen(types);
+        for (col_idx = 0; col_idx < chunk->ncols; col_idx++) {
+            const Column *column = &CHUNK_COLUMN(chunk, col_idx);
+            int col_type = types[col_idx % ntypes] == 'i' ? COL_TYPE_INT64 : COL_TYPE_DOUBLE;
+            if (column->type != col_type || column->out_type != col_type) {
+                break;
+            }
+        }
+        if (col_idx == chunk->ncols) {
+            return i;
         }
-        nrows += chunks[i].nrows;
     }
 
-    common->str_idxs = (int *)malloc(ncols * sizeof(int));
+    return -1;
+}
 
-    for (col_idx = 0; col_idx < ncols; col_idx++) {
-        uchar *xs;
-        int col_type;
-        width_t width;
+/* Find the first ncells cells of the row, as begin and end pairs.
+   Missing cells at the end of the row are empty. */
+static void
+split_row(const uchar *p, const uchar *row_end, uchar sep, const uchar **cells, int ncells)
+{
+    int col_idx;
 
-        col_type = COL_TYPE_INT32;
-        width = 1;  /* numpy has minimum string len of 1 */
-        for (i = 0; i < nchunks; i++) {
-            Column *column;
-            if (col_idx >= chunks[i].ncols) {
-                continue;
-            }
-            column = &CHUNK_COLUMN(&chunks[i], col_idx);
-            if (column->type > col_type) {  /* "supertype" */
-                col_type = column->type;
-            }
-            if (column->width > width) {
-                width = column->width;
-            }
+    for (col_idx = 0; col_idx < ncells; col_idx++) {
+        cells[2 * col_idx] = p;
+        p = skip_cell(p, row_end, sep);
+        cells[2 * col_idx + 1] = p;
+        if (p < row_end) {
+            ++p;
         }
+    }
+}
 
-        if (common->result->fix_column_type != NULL) {
-            col_type = common->result->fix_column_type(common->result, col_idx, col_type);
-        }
+/* The value the cell gets in a numeric column, as in fill_arrays.
+   Returns 1 if the cell is null and got the missing value, else 0. */
+static int
+cell_number(ThreadCommon *common, int col_type, const uchar *p, const uchar *buf_end,
+            int64_t *int_val, double *float_val)
+{
+    const uchar *cellp = p;
+    const uchar sep = common->sep;
+    int nquotes = 0;
+    uchar c;
+    int digit;
+    int64_t value = 0;
+    int expo = 0;
+    int fracexpo = 0;
+    int exposign = 1;
+
+    if (p >= buf_end) {
+        goto badend;
+    }
 
-        /* make the column the same type in each chunk */
-        for (i = 0; i < nchunks; i++) {
-            Column *column;
-            array_buf_enlarge(&chunks[i].columns, ncols * sizeof(Column));
-            column = &CHUNK_COLUMN(&chunks[i], col_idx);
-            if (col_idx >= chunks[i].ncols) {
-                column->first_row = 0;
-            }
-            column->type = col_type;
-            column->width = width;
+    c = *p;
+
+    if (c == '"') {
+        ++nquotes;
+        ++cellp;
+        NEXTCHAR2_INQUOTES(goodend);
+
+#include "parser2_inquotes.h"
+
+    } else {
+
+#include "parser2.h"
+
+    }
+
+    if (nquotes != 1) {  /* c not in quotes */
+        if (c == '\r') {
+            NEXTCHAR_NOQUOTES(goodend);
         }
 
-        if (col_type == COL_TYPE_INT32) {
-            xs = (uchar *)common->result->add_column(common->result, col_type, nrows, 0);
-            for (i = 0; i < nchunks; i++) {
-                CHUNK_COLUMN(&chunks[i], col_idx).arr_ptr = xs;
-                xs += chunks[i].nrows * sizeof(int32_t);
-            }
-        } if (col_type == COL_TYPE_INT64) {
-            xs = (uchar *)common->result->add_column(common->result, col_type, nrows, 0);
-            for (i = 0; i < nchunks; i++) {
-                CHUNK_COLUMN(&chunks[i], col_idx).arr_ptr = xs;
-                xs += chunks[i].nrows * sizeof(int64_t);
-            }
-        } else if (col_type == COL_TYPE_DOUBLE) {
-            xs = (uchar *)common->result->add_column(common->result, col_type, nrows, 0);
-            for (i = 0; i < nchunks; i++) {
-                CHUNK_COLUMN(&chunks[i], col_idx).arr_ptr = xs;
-                xs += chunks[i].nrows * sizeof(double);
-            }
-        } else if (col_type == COL_TYPE_STRING) {
-#if NUMPY_STRING_OBJECT
-            arr = PyArray_SimpleNew(1, dims, NPY_OBJECT);
-            xs = (uchar *)PyArray_DATA((PyArrayObject *)arr);
-            for (i = 0; i < nrows; i++) {
-                /* PyString_FromStringAndSize is not thread-safe. */
-                ((PyObject **)xs)[i] = PyString_FromStringAndSize(NULL, width);
-            }
-            for (i = 0; i < nchunks; i++) {
-                CHUNK_COLUMN(&chunks[i], col_idx).arr_ptr = xs;
-                xs += chunks[i].nrows * sizeof(PyObject *);
-            }
-#else
-            xs = (uchar *)common->result->add_column(common->result, col_type, nrows, width);
-            for (i = 0; i < nchunks; i++) {
-                CHUNK_COLUMN(&chunks[i], col_idx).arr_ptr = xs;
-                xs += chunks[i].nrows * width;
-            }
-#endif
-            common->str_idxs[n_str_cols] = col_idx;
-            n_str_cols++;
+        if (c == sep || c == '\n') {
+            goto goodend;
         }
     }
 
-    /* Give each chunk the same number of columns */
-    for (i = 0; i < nchunks; i++) {
-        chunks[i].ncols = ncols;
-    }
+ bad:
+ badend:
+    cellp = p;
 
-    common->n_str_cols = n_str_cols;
+ goodend:
+
+    if (common->n_na_tokens > 0 && nquotes == 0 && is_na_token(common, cellp, p)) {
+        cellp = p;
+    }
 
+    if (col_type != COL_TYPE_DOUBLE) {
+        int is_null = (p == cellp || fracexpo != 0);
+        if (is_null) {
+            value = common->missing_int_val;
+        }
+        *int_val = (col_type == COL_TYPE_INT32) ? (int32_t)value : value;
+        return is_null;
+    } else if (p == cellp) {
+        *float_val = common->missing_float_val;
+        return 1;
+    }
+    *float_val = parsed_double(value, expo, fracexpo, exposign, 0);
     return 0;
 }
 
+/* Compares the cell, as it would be in a string column, with str. */
 static int
-parse_stage1(ThreadCommon *common, Chunk *chunk)
+cell_strcmp(const uchar *p, const uchar *buf_end, uchar sep, const uchar *str, size_t len)
 {
-    const uchar *buf = chunk->buf;
-    const uchar *buf_end = chunk->buf_end;
-    const uchar *soft_end = chunk->soft_end;  /* can go past this in middle of line */
-    const uchar sep = common->sep;
-    LinkedBuf *offset_buf = &chunk->offset_buf;
-    Column *columns = &CHUNK_COLUMN(chunk, 0);
-    const uchar *p = buf;
-    const uchar *cellp = NULL;
-    const uchar *rowp = buf;
-    int col_idx = 0, row_idx = -1;  /* currently not parsing a row */
-    int ncols = 0;
-    uchar c = 0;
+    const uchar *str_end = str + len;
+    uchar c;
 
-    LINKED_INIT(offset_buf, width_t);
+    if (p >= buf_end) {
+        goto atstringend;
+    }
 
-    if (chunk->chunk_idx > 0) {
+    c = *p;
+
+    if (c == '"') {
+        /* c is opening quote here */
         while (1) {
+            ++p;
             if (p >= buf_end) {
-                chunk->buf = p;
-                goto finished;  /* just exit nicely */
+                goto atstringend;
             }
-            c = *p++;
-            if (c == '\n') {
-                break;
+            c = *p;
+            if (c == '\r') {
+                continue;
             }
-        }
-        chunk->buf = p;
-        if (p > soft_end) {  /* newline (ie. p-1) >= soft_end */
-            goto finished;
+            if (c == '"') {
+                ++p;
+                if (p >= buf_end) {
+                    goto atstringend;
+                }
+                c = *p;
+                if (c != '"') {
+                    break;
+                }
+            }
+            if (str >= str_end) {
+                return 1;
+            }
+            if (c != *str) {
+                return (c < *str) ? -1 : 1;
+            }
+            ++str;
         }
     }
-
-    rowp = p;
-    row_idx = 0;
+    /* c is non-quoted char here */
     while (1) {
-        /* Start of cell */
-
-        width_t width = 0;
-        int nquotes = 0;
-        int col_type;
-        int digit;
-#ifdef WITH_NUMIDX
-        size_t numidx;
-#endif
-
-        if (col_idx >= ncols) {
-            ncols++;
-            columns = (Column *)array_buf_enlarge(&chunk->columns, ncols * sizeof(Column));
-            COLUMN_INIT(&CHUNK_COLUMN(chunk, col_idx), row_idx, COL_TYPE_INT64);
+        if (c == sep || c == '\n') {
+            break;
         }
+        if (c != '\r') {
+            if (str >= str_end) {
+                return 1;
+            }
+            if (c != *str) {
+                return (c < *str) ? -1 : 1;
+            }
+            ++str;
+        }
+        ++p;
         if (p >= buf_end) {
-            goto athardend;
+            break;
         }
+        c = *p;
+    }
 
-        cellp = p;
-
-        col_type = CHUNK_COLUMN(chunk, col_idx).type;
+ atstringend:
+    return (str < str_end) ? -1 : 0;
+}
 
-        c = *p;
+/* Whether the cell, as it would be in a string column, is an NA token. */
+static int
+cell_is_na(const ThreadCommon *common, const uchar *p, const uchar *buf_end)
+{
+    int i;
 
-        if (col_type == COL_TYPE_STRING) {
-            goto parsestring;
+    for (i = 0; i < common->n_na_tokens; i++) {
+        const FastCsvValue *token = &common->na_tokens[i];
+        if (cell_strcmp(p, buf_end, common->sep, token->str, token->len) == 0) {
+            return 1;
         }
+    }
 
-        if (c == '"') {
-            ++nquotes;
-            ++cellp;
-            if (!(common->flags & FLAG_EXCEL_QUOTES)) {
-                goto bad;
-            }
-            NEXTCHAR_INQUOTES(goodend);
-
-#include "parser_inquotes.h"
+    return 0;
+}
 
-        } else {
+/* Copies the cell as it would be in a string column, zero padded. */
+static void
+cell_copy(const uchar *p, const uchar *buf_end, uchar sep, uchar *dest, size_t width)
+{
+    uchar *q = dest;
+    uchar *q_end = dest + width;
+    uchar c;
 
-#include "parser.h"
+    if (p >= buf_end) {
+        goto atstringend;
+    }
 
-        }
+    c = *p;
 
-        if (nquotes != 1) {  /* c not in quotes */
-            if (c == '\r') {
-                ++cellp;  /* make width smaller */
-                NEXTCHAR_NOQUOTES(goodend);
+    if (c == '"') {
+        /* c is opening quote here */
+        while (1) {
+            const uchar *run_end = find_quote(p + 1, buf_end);
+            size_t len = run_end - (p + 1);
+            if (len > (size_t)(q_end - q)) {
+                len = q_end - q;
             }
-
-            if (c == sep || c == '\n') {
-                goto comma;
+            memcpy(q, p + 1, len);
+            q += len;
+            p = run_end;
+            if (p >= buf_end) {
+                goto atstringend;
             }
-        }
-    bad:
-        columns[col_idx].type = COL_TYPE_STRING;
-        goto atstringbegin;
-
-    badend:
-        columns[col_idx].type = COL_TYPE_STRING;
-        goto comma;
-
-    parsestring:
-        if (c == '"') {
-            ++cellp;
-            ++nquotes;
-        }
-
-    atstringbegin:
-        if (nquotes == 1) {
-            while (1) {
-                if (c == '\r') {
-                    ++cellp;  /* make width smaller */
-                }
+            c = *p;
+            if (c == '\r') {
+                continue;
+            }
+            if (c == '"') {
                 ++p;
                 if (p >= buf_end) {
-                    goto comma;
+                    goto atstringend;
                 }
                 c = *p;
-                if (c == '"') {
-                    ++cellp;
-                    ++p;
-                    if (p >= buf_end) {
-                        goto comma;
-                    }
-                    c = *p;
-                    if (c != '"') {
-                        ++nquotes;
-                        break;
-                    }
+                if (c != '"') {
+                    break;
                 }
             }
+            if (q < q_end) {
+                *q++ = c;
+            }
+        }
+    }
+    /* c is non-quoted char here */
+    while (1) {
+        if (c == sep || c == '\n') {
+            break;
         }
+        if (c != '\r' && q < q_end) {
+            *q++ = c;
+        }
+        ++p;
+        if (p >= buf_end) {
+            break;
+        }
+        c = *p;
+    }
 
-        /* c is first char of string here */
-        while (1) {
-            if (c == sep || c == '\n') {
-                break;
-            }
-            if (c == '\r') {
-                ++cellp;  /* make width smaller */
-            }
-            ++p;
-            if (p >= buf_end) {
-                break;
+ atstringend:
+    memset(q, 0, q_end - q);
+}
+
+/* Fill common->fill_col alone, for a table from open_csv.  The row
+   offsets from parse_stage1 give the start of each row, so the cells
+   after the column are never looked at. */
+static int
+fill_column(ThreadCommon *common, Chunk *chunk)
+{
+    const int col_idx = common->fill_col;
+    const Column *column = &CHUNK_COLUMN(chunk, col_idx);
+    LinkedLink *offset_link = chunk->offset_buf.first;
+    uchar *offset_ptr = chunk->offset_buf.first_data;
+    const uchar *rowp = chunk->buf;
+    const uchar sep = common->sep;
+    int row_idx, i;
+
+    for (row_idx = 0; row_idx < chunk->nrows; row_idx++) {
+        width_t row_width = *((width_t *)offset_ptr);
+        const uchar *buf_end = rowp + row_width - 1;  /* newline, or buf_end */
+        const uchar *p = rowp;
+        const uchar *cellp;
+        int nquotes = 0;
+        uchar c;
+        int digit;
+        int64_t value = 0;
+        int expo = 0;
+        int fracexpo = 0;
+        int exposign = 1;
+
+        LINKED_NEXT(offset_link, offset_ptr, width_t);
+        rowp += row_width;
+
+        for (i = 0; i < col_idx && p < buf_end; i++) {
+            p = skip_cell(p, buf_end, sep);
+            if (p < buf_end) {
+                ++p;
             }
-            c = *p;
+        }
+        if (i < col_idx) {
+            p = buf_end;  /* missing cell */
         }
 
-    goodend:
-    comma:
-        width = (width_t)(p - cellp);
-        if (width > columns[col_idx].width) {
-            columns[col_idx].width = width;
+        if (column->type == COL_TYPE_STRING) {
+            uchar *dest = column->arr_ptr + row_idx * column->width;
+            if (common->n_na_tokens > 0 && cell_is_na(common, p, buf_end)) {
+                memset(dest, 0, column->width);
+            } else {
+                cell_copy(p, buf_end, sep, dest, column->width);
+            }
+            continue;
         }
 
+        cellp = p;
+
         if (p >= buf_end) {
-            goto athardend;
+            goto goodend;
         }
 
-        if (c == '\n') {
-            LINKED_PUT(offset_buf, width_t, (width_t)(p - rowp + 1));
+        c = *p;
 
-            if (p >= soft_end) {  /* newline (ie. p) >= soft_end */
-                /* break out before we get set for new row */
-                goto finished;
-            }
+        if (c == '"') {
+            ++nquotes;
+            ++cellp;
+            NEXTCHAR2_INQUOTES(goodend);
+
+#include "parser2_inquotes.h"
 
-            col_idx = 0;
-            row_idx++;
-            rowp = p + 1;
         } else {
-            col_idx++;
+
+#include "parser2.h"
+
         }
-        p++;
-    }
 
- athardend:
+        if (nquotes != 1) {  /* c not in quotes */
+            if (c == '\r') {
+                NEXTCHAR_NOQUOTES(goodend);
+            }
 
-    /* pretend separator for consistency */
-    LINKED_PUT(offset_buf, width_t, (width_t)(p - rowp + 1));
+            if (c == sep || c == '\n') {
+                goto goodend;
+            }
+        }
 
-    /* empty last line? */
-    if (p == rowp) {
-        row_idx--;
-    }
+    bad:
+    badend:
+        cellp = p;
 
- finished:
+    goodend:
+        store_number(common, chunk, col_idx, row_idx,
+                     p == cellp || (common->n_na_tokens > 0 && nquotes == 0
+                                    && is_na_token(common, cellp, p)),
+                     value, expo, fracexpo, exposign);
+    }
 
-    chunk->ncols = ncols;
-    chunk->nrows = row_idx + 1;
-    chunk->found_end = p;
+    return 0;
+}
 
+static int
+filter_test(int op, int cmp)
+{
+    switch (op) {
+    case FILTER_EQ:
+    case FILTER_IN:
+        return cmp == 0;
+    case FILTER_NE:
+        return cmp != 0;
+    case FILTER_LT:
+        return cmp == -1;
+    case FILTER_LE:
+        return cmp == -1 || cmp == 0;
+    case FILTER_GT:
+        return cmp == 1;
+    case FILTER_GE:
+        return cmp == 1 || cmp == 0;
+    }
     return 0;
 }
 
+/* cells has the begin and end of each cell the filter looks at. */
 static int
-fixup_parse(ThreadCommon *common)
+filter_match(ThreadCommon *common, const FastCsvFilter *filter, const Column *columns,
+             const uchar **cells)
 {
-    Chunk *bigchunk;
-    LinkedLink *offset_link;
-    uchar *offset_ptr;
-    const uchar *rowp;
-    int first_row;
-    int i, previ;
+    const uchar *cell, *cell_end;
+    int64_t int_val = 0;
+    double float_val = 0.0;
+    int col_type;
+    int i;
 
-    previ = 0;
-    for (i = 1; ; i++) {
-        if (i >= common->nchunks) {
-            return 0;
-        }
-        if (common->all_chunks[i].nrows == 0) {
-            continue;  /* empty chunk */
+    if (filter->op == FILTER_AND) {
+        for (i = 0; i < filter->nchildren; i++) {
+            if (!filter_match(common, &filter->children[i], columns, cells)) {
+                return 0;
+            }
         }
-        if (common->all_chunks[previ].found_end + 1 != common->all_chunks[i].buf) {
-            break;
+        return 1;
+    }
+    if (filter->op == FILTER_OR) {
+        for (i = 0; i < filter->nchildren; i++) {
+            if (filter_match(common, &filter->children[i], columns, cells)) {
+                return 1;
+            }
         }
-        previ = i;
+        return 0;
     }
 
-    bigchunk = (Chunk *)malloc(sizeof(Chunk));
-    common->bigchunk = bigchunk;
-
-    /* fix everything from chunk[i] onward */
-    bigchunk->chunk_idx = i;
-    bigchunk->buf = common->all_chunks[previ].found_end;
-    bigchunk->soft_end = common->all_chunks[previ].buf_end;
-    bigchunk->buf_end = common->all_chunks[previ].buf_end;
-    array_buf_init(&bigchunk->columns);
-
-    parse_stage1(common, bigchunk);
-
-    offset_link = bigchunk->offset_buf.first;
-    offset_ptr = offset_link->data;
-    rowp = bigchunk->buf;
-
-    first_row = 0;
-    for ( ; i < common->nchunks; i++) {
-        Chunk *chunk = &common->all_chunks[i];
-        int nrows = 0, ncols = 0;
-        int col_idx;
-
-        linked_free(&chunk->offset_buf);
+    col_type = columns[filter->col_idx].type;
+    cell = cells[2 * filter->col_idx];
+    cell_end = cells[2 * filter->col_idx + 1];
 
-        chunk->buf = rowp;
-        chunk->offset_buf.own_data = 0;
-        chunk->offset_buf.first = offset_link;
-        chunk->offset_buf.first_data = offset_ptr;
+    if (col_type != COL_TYPE_STRING) {
+        cell_number(common, col_type, cell, cell_end, &int_val, &float_val);
+    } else if (common->n_na_tokens > 0 && cell_is_na(common, cell, cell_end)) {
+        cell_end = cell;  /* empty, as loaded */
+    }
 
-        while (rowp < chunk->soft_end) {
-            rowp += *((width_t *)offset_ptr);
-            LINKED_NEXT(offset_link, offset_ptr, width_t);
-            nrows++;
+    for (i = 0; i < filter->nvalues; i++) {
+        const FastCsvValue *v = &filter->values[i];
+        int cmp;
+        if (col_type == COL_TYPE_STRING) {
+            cmp = cell_strcmp(cell, cell_end, common->sep, v->str, v->len);
+        } else if (col_type != COL_TYPE_DOUBLE && v->type == COL_TYPE_INT64) {
+            cmp = (int_val > v->int_val) - (int_val < v->int_val);
+        } else {
+            double x = (col_type == COL_TYPE_DOUBLE) ? float_val : (double)int_val;
+            double y = (v->type == COL_TYPE_INT64) ? (double)v->int_val : v->float_val;
+            cmp = (x < y) ? -1 : (x > y) ? 1 : (x == y) ? 0 : FILTER_UNORDERED;
+        }
+        if (filter_test(filter->op, cmp)) {
+            return 1;
         }
+    }
 
-        chunk->nrows = nrows;
+    return 0;
+}
 
-        for (col_idx = 0; col_idx < bigchunk->ncols; col_idx++) {
-            Column *bigcolumn = &CHUNK_COLUMN(bigchunk, col_idx);
-            Column *column;
+/* Decide which rows of the chunk to keep, after resolve_columns. */
+static int
+filter_rows(ThreadCommon *common, Chunk *chunk)
+{
+    const Column *columns = &CHUNK_COLUMN(chunk, 0);
+    const uchar **cells;
+    LinkedLink *offset_link = chunk->offset_buf.first;
+    uchar *offset_ptr = chunk->offset_buf.first_data;
+    const uchar *rowp = chunk->buf;
+    int ncells = common->filter_ncols;
+    int row_idx;
+    int nkeep = 0;
 
-            if (bigcolumn->first_row >= first_row + nrows) {
-                break;
-            }
+    if (chunk->nrows == 0) {
+        return 0;
+    }
 
-            array_buf_enlarge(&chunk->columns, (col_idx + 1) * sizeof(Column));
+    chunk->keep = (uchar *)malloc(chunk->nrows);
+    cells = (const uchar **)malloc(2 * ncells * sizeof(const uchar *));
 
-            column = &CHUNK_COLUMN(chunk, col_idx);
+    for (row_idx = 0; row_idx < chunk->nrows; row_idx++) {
+        width_t row_width = *((width_t *)offset_ptr);
+        const uchar *row_end = rowp + row_width - 1;  /* newline, or buf_end */
 
-            column->type = bigcolumn->type;
-            column->width = bigcolumn->width;
-            if (bigcolumn->first_row > first_row) {
-                column->first_row = bigcolumn->first_row - first_row;
-            } else {
-                column->first_row = 0;
-            }
+        LINKED_NEXT(offset_link, offset_ptr, width_t);
 
-            ncols++;
-        }
+        split_row(rowp, row_end, common->sep, cells, ncells);
 
-        chunk->ncols = ncols;
-        first_row += nrows;
+        chunk->keep[row_idx] = filter_match(common, common->filter, columns, cells);
+        nkeep += chunk->keep[row_idx];
+        rowp += row_width;
     }
 
+    free(cells);
+
+    chunk->nkeep = nkeep;
+
     return 0;
 }
 
-#ifdef _WIN32
-static unsigned int __stdcall
-#else
-static void *
-#endif
-parse_thread(void *data)
+static void
+filter_set_column(FastCsvFilter *filter, const uchar *name, size_t len, int col_idx)
 {
-    Reader *reader = (Reader *)data;
+    int i;
 
-    while (1) {
-        ThreadData *thread_data = queue_pop(&reader->inqueue);
+    for (i = 0; i < filter->nchildren; i++) {
+        filter_set_column(&filter->children[i], name, len, col_idx);
+    }
 
-        ThreadCommon *common = thread_data->common;
+    /* NULL name to forget previous lookups */
+    if (filter->col_name != NULL
+        && (name == NULL
+            || (filter->col_idx < 0 && filter->col_name_len == len
+                && memcmp(filter->col_name, name, len) == 0))) {
+        filter->col_idx = col_idx;
+    }
+}
 
-        Chunk *chunk = thread_data->chunk;
+/* Columns after resolve_columns, or 0 if there are no rows. */
+static int
+resolved_ncols(ThreadCommon *common)
+{
+    int i;
 
-        if (thread_data->stage == 1) {
-            parse_stage1(common, chunk);
-        } else {
-            fill_arrays(common, chunk);
+    for (i = 0; i < common->nchunks; i++) {
+        if (common->all_chunks[i].nrows > 0) {
+            return common->all_chunks[0].ncols;
         }
-
-        queue_push(&reader->outqueue, thread_data);
     }
 
-#ifdef _WIN32
     return 0;
-#else
-    return NULL;
-#endif
 }
 
-static const uchar *
-parse_headers(ThreadCommon *common, const uchar *csv_buf, const uchar *buf_end)
+/* Check the filter against the resolved columns. */
+static int
+check_filter(ThreadCommon *common, const FastCsvFilter *filter)
 {
-    const uchar *p = csv_buf;
-    uchar *cellbuf, *new_cellbuf, *q;
-    size_t cell_space;
+    int ncols = resolved_ncols(common);
+    int col_type;
+    int i, rc;
+
+    if (filter->op == FILTER_AND || filter->op == FILTER_OR) {
+        for (i = 0; i < filter->nchildren; i++) {
+            if ((rc = check_filter(common, &filter->children[i])) != 0) {
+                return rc;
+            }
+        }
+        return 0;
+    }
+
+    if (filter->col_idx < 0) {
+        return FASTCSV_ERR_FILTER_COLUMN;
+    }
+    if (ncols == 0) {
+        return 0;  /* no rows */
+    }
+    if (filter->col_idx >= ncols) {
+        return FASTCSV_ERR_FILTER_COLUMN;
+    }
+
+    col_type = CHUNK_COLUMN(&common->all_chunks[0], filter->col_idx).type;
+    for (i = 0; i < filter->nvalues; i++) {
+        if ((filter->values[i].type == COL_TYPE_STRING) != (col_type == COL_TYPE_STRING)) {
+            return FASTCSV_ERR_FILTER_TYPE;
+        }
+    }
+
+    if (filter->col_idx >= common->filter_ncols) {
+        common->filter_ncols = filter->col_idx + 1;
+    }
+
+    return 0;
+}
+
+static void
+partition_set_column(FastCsvPartition *partition, const uchar *name, size_t len, int col_idx)
+{
+    /* NULL name to forget previous lookups */
+    if (partition->col_name != NULL
+        && (name == NULL
+            || (partition->col_idx < 0 && partition->col_name_len == len
+                && memcmp(partition->col_name, name, len) == 0))) {
+        partition->col_idx = col_idx;
+    }
+}
+
+/* Check the partition key against the resolved columns. */
+static int
+check_partition(ThreadCommon *common)
+{
+    int ncols = resolved_ncols(common);
+    int col_idx = common->partition->col_idx;
+
+    if (col_idx < 0 || (ncols > 0 && col_idx >= ncols)) {
+        return FASTCSV_ERR_PARTITION_COLUMN;
+    }
+
+    return 0;
+}
+
+/* Hash of the key cell as loaded, so equal values in any file or column
+   width go to the same partition. */
+static uint64_t
+partition_hash(ThreadCommon *common, const Column *column, const uchar *cell,
+               const uchar *cell_end, uchar *strbuf)
+{
+    uint64_t h = 14695981039346656037ULL;  /* FNV-1a */
+    int64_t int_val = 0;
+    double float_val = 0.0;
+    size_t len;
+    size_t i;
+
+    if (column->type == COL_TYPE_STRING) {
+        if (common->n_na_tokens > 0 && cell_is_na(common, cell, cell_end)) {
+            len = 0;  /* empty, as loaded */
+        } else {
+            cell_copy(cell, cell_end, common->sep, strbuf, column->width);
+            for (len = column->width; len > 0 && strbuf[len - 1] == 0; len--) {
+            }
+        }
+        for (i = 0; i < len; i++) {
+            h = (h ^ strbuf[i]) * 1099511628211ULL;
+        }
+        return hash_mix(h);
+    }
+
+    cell_number(common, column->type, cell, cell_end, &int_val, &float_val);
+    if (column->type != COL_TYPE_DOUBLE) {
+        return hash_mix((uint64_t)int_val);
+    }
+    if (float_val == 0.0) {
+        float_val = 0.0;  /* not -0.0 */
+    } else if (float_val != float_val) {
+        float_val = NAN;  /* one NaN */
+    }
+    memcpy(&h, &float_val, sizeof(double));
+    return hash_mix(h);
+}
+
+/* Find the partition of each kept row of the chunk, and count the rows
+   of each partition in part_out. */
+static int
+partition_rows(ThreadCommon *common, Chunk *chunk)
+{
+    const FastCsvPartition *partition = common->partition;
+    const Column *column;
+    const uchar **cells;
+    LinkedLink *offset_link = chunk->offset_buf.first;
+    uchar *offset_ptr = chunk->offset_buf.first_data;
+    const uchar *rowp = chunk->buf;
+    int ncells = partition->col_idx + 1;
+    uchar *strbuf;
+    int row_idx;
+
+    chunk->part_out = (int *)calloc(partition->nparts, sizeof(int));
+    chunk->part_end = (int *)malloc(partition->nparts * sizeof(int));
+
+    if (chunk->nrows == 0) {
+        return 0;
+    }
+
+    column = &CHUNK_COLUMN(chunk, partition->col_idx);
+    chunk->parts = (unsigned short *)malloc(chunk->nrows * sizeof(unsigned short));
+    cells = (const uchar **)malloc(2 * ncells * sizeof(const uchar *));
+    strbuf = (uchar *)malloc(column->width);
+
+    for (row_idx = 0; row_idx < chunk->nrows; row_idx++) {
+        width_t row_width = *((width_t *)offset_ptr);
+        const uchar *row_end = rowp + row_width - 1;  /* newline, or buf_end */
+        int part;
+
+        LINKED_NEXT(offset_link, offset_ptr, width_t);
+
+        if (chunk->keep != NULL && !chunk->keep[row_idx]) {
+            rowp += row_width;
+            continue;
+        }
+
+        split_row(rowp, row_end, common->sep, cells, ncells);
+
+        part = (int)(partition_hash(common, column, cells[2 * partition->col_idx],
+                                    cells[2 * partition->col_idx + 1], strbuf)
+                     % (uint64_t)partition->nparts);
+        chunk->parts[row_idx] = (unsigned short)part;
+        chunk->part_out[part]++;
+        rowp += row_width;
+    }
+
+    free(strbuf);
+    free(cells);
+
+    return 0;
+}
+
+/* Turn the counts in part_out into where each chunk's rows of each
+   partition go, as out_idx from the start of the column.  The rows of a
+   partition are together, in chunk order. */
+static void
+partition_offsets(ThreadCommon *common)
+{
+    FastCsvPartition *partition = common->partition;
+    Chunk *chunks = common->all_chunks;
+    int nparts = partition->nparts;
+    int out_idx = 0;
+    int i, part;
+
+    for (part = 0; part < nparts; part++) {
+        partition->nrows[part] = 0;
+        for (i = 0; i < common->nchunks; i++) {
+            partition->nrows[part] += chunks[i].part_out[part];
+        }
+    }
+
+    for (part = 0; part < nparts; part++) {
+        for (i = 0; i < common->nchunks; i++) {
+            int count = chunks[i].part_out[part];
+            chunks[i].part_out[part] = out_idx;
+            chunks[i].part_end[part] = out_idx + count;
+            out_idx += count;
+        }
+    }
+}
+
+static void *
+call_add_column(ThreadCommon *common, int col_type, size_t nrows, size_t width)
+{
+    void *xs;
+    double t;
+
+    if (common->stats == NULL) {
+        return common->result->add_column(common->result, col_type, nrows, width);
+    }
+
+    t = clock_now();
+    xs = common->result->add_column(common->result, col_type, nrows, width);
+    common->stats->add_column_time += clock_now() - t;
+
+    return xs;
+}
+
+/* Output type of a group key or aggregated column. */
+static int
+agg_column_type(ThreadCommon *common, int col_idx)
+{
+    int col_type;
+
+    if (col_idx >= resolved_ncols(common)) {
+        return COL_TYPE_INT64;  /* no rows */
+    }
+    col_type = CHUNK_COLUMN(&common->all_chunks[0], col_idx).type;
+
+    return (col_type == COL_TYPE_INT32) ? COL_TYPE_INT64 : col_type;
+}
+
+static size_t
+agg_key_width(ThreadCommon *common, int col_idx)
+{
+    if (agg_column_type(common, col_idx) == COL_TYPE_STRING) {
+        return CHUNK_COLUMN(&common->all_chunks[0], col_idx).width;
+    }
+    return sizeof(int64_t);
+}
+
+static void
+agg_key(ThreadCommon *common, const Column *columns, const uchar **cells, uchar *key)
+{
+    const FastCsvAggregate *aggregate = common->aggregate;
+    uchar *q = key;
+    int i;
+
+    memset(key, 0, common->agg_key_space);
+
+    for (i = 0; i < aggregate->nkeys; i++) {
+        int col_idx = aggregate->keys[i].col_idx;
+        const Column *column = &columns[col_idx];
+        int64_t int_val = 0;
+        double float_val = 0.0;
+
+        if (column->type == COL_TYPE_STRING) {
+            if (common->n_na_tokens == 0
+                || !cell_is_na(common, cells[2 * col_idx], cells[2 * col_idx + 1])) {
+                cell_copy(cells[2 * col_idx], cells[2 * col_idx + 1], common->sep, q,
+                          column->width);
+            }
+            q += column->width;
+            continue;
+        }
+
+        cell_number(common, column->type, cells[2 * col_idx], cells[2 * col_idx + 1],
+                    &int_val, &float_val);
+        if (column->type == COL_TYPE_DOUBLE) {
+            if (float_val == 0.0) {
+                float_val = 0.0;  /* not -0.0 */
+            } else if (float_val != float_val) {
+                float_val = NAN;  /* one NaN */
+            }
+            memcpy(q, &float_val, sizeof(double));
+        } else {
+            memcpy(q, &int_val, sizeof(int64_t));
+        }
+        q += sizeof(int64_t);
+    }
+}
+
+/* Adds slots, each with counts[i] non-null cells, to the entry. */
+static void
+agg_combine(ThreadCommon *common, const AggTable *table, uchar *entry, const AggSlot *slots,
+            const int64_t *counts)
+{
+    const FastCsvAggregate *aggregate = common->aggregate;
+    AggSlot *dest = AGG_ENTRY_SLOTS(entry);
+    int64_t *dest_counts = AGG_ENTRY_COUNTS(table, entry);
+    int i;
+
+    for (i = 0; i < aggregate->naggs; i++) {
+        int is_double = (common->agg_slot_types[i] == COL_TYPE_DOUBLE);
+        int first = (dest_counts[i] == 0);
+
+        if (counts[i] == 0) {
+            continue;
+        }
+        dest_counts[i] += counts[i];
+
+        switch (aggregate->aggs[i].op) {
+        case AGG_SUM:
+        case AGG_MEAN:
+            if (is_double) {
+                dest[i].d += slots[i].d;
+            } else {
+                dest[i].i += slots[i].i;
+            }
+            break;
+        case AGG_MIN:
+            if (is_double) {
+                if (first || slots[i].d < dest[i].d || dest[i].d != dest[i].d) {
+                    dest[i].d = slots[i].d;
+                }
+            } else if (first || slots[i].i < dest[i].i) {
+                dest[i].i = slots[i].i;
+            }
+            break;
+        case AGG_MAX:
+            if (is_double) {
+                if (first || slots[i].d > dest[i].d || dest[i].d != dest[i].d) {
+                    dest[i].d = slots[i].d;
+                }
+            } else if (first || slots[i].i > dest[i].i) {
+                dest[i].i = slots[i].i;
+            }
+            break;
+        }
+    }
+}
+
+/* Whether the cell is null, as in the validity from fill_arrays. */
+static int
+agg_cell_is_null(ThreadCommon *common, int col_type, const uchar *p, const uchar *buf_end)
+{
+    int64_t int_val;
+    double float_val;
+    uchar c = 0;
+
+    if (col_type != COL_TYPE_STRING) {
+        return cell_number(common, col_type, p, buf_end, &int_val, &float_val);
+    }
+    if (common->n_na_tokens > 0 && cell_is_na(common, p, buf_end)) {
+        return 1;
+    }
+    cell_copy(p, buf_end, common->sep, &c, 1);
+    return (c == 0);
+}
+
+/* Aggregate the kept rows of the chunk into its own table. */
+static int
+aggregate_rows(ThreadCommon *common, Chunk *chunk)
+{
+    const FastCsvAggregate *aggregate = common->aggregate;
+    const Column *columns = &CHUNK_COLUMN(chunk, 0);
+    const uchar **cells;
+    LinkedLink *offset_link = chunk->offset_buf.first;
+    uchar *offset_ptr = chunk->offset_buf.first_data;
+    const uchar *rowp = chunk->buf;
+    AggSlot *slots;
+    int64_t *counts;
+    uchar *key;
+    uchar *entry = NULL;
+    int row_idx, i;
+
+    if (chunk->nrows == 0) {
+        return 0;
+    }
+
+    chunk->agg_table = (AggTable *)malloc(sizeof(AggTable));
+    agg_table_init(chunk->agg_table, common->agg_key_space, aggregate->naggs);
+
+    cells = (const uchar **)malloc(2 * common->agg_ncols * sizeof(const uchar *));
+    slots = (AggSlot *)malloc((aggregate->naggs + 1) * sizeof(AggSlot));
+    counts = (int64_t *)malloc((aggregate->naggs + 1) * sizeof(int64_t));
+    key = (uchar *)malloc(common->agg_key_space + 1);
+
+    for (row_idx = 0; row_idx < chunk->nrows; row_idx++) {
+        width_t row_width = *((width_t *)offset_ptr);
+        const uchar *row_end = rowp + row_width - 1;  /* newline, or buf_end */
+
+        LINKED_NEXT(offset_link, offset_ptr, width_t);
+
+        if (chunk->keep != NULL && !chunk->keep[row_idx]) {
+            rowp += row_width;
+            continue;
+        }
+
+        split_row(rowp, row_end, common->sep, cells, common->agg_ncols);
+
+        for (i = 0; i < aggregate->naggs; i++) {
+            int col_idx = aggregate->aggs[i].col_idx;
+            int col_type;
+            int64_t int_val = 0;
+            double float_val = 0.0;
+
+            if (col_idx < 0) {
+                counts[i] = 1;  /* count rows */
+                continue;
+            }
+            col_type = columns[col_idx].type;
+            if (aggregate->aggs[i].op == AGG_COUNT) {
+                counts[i] = !agg_cell_is_null(common, col_type, cells[2 * col_idx],
+                                              cells[2 * col_idx + 1]);
+                continue;
+            }
+            counts[i] = !cell_number(common, col_type, cells[2 * col_idx],
+                                     cells[2 * col_idx + 1], &int_val, &float_val);
+            if (common->agg_slot_types[i] == COL_TYPE_DOUBLE) {
+                slots[i].d = (col_type == COL_TYPE_DOUBLE) ? float_val : (double)int_val;
+            } else {
+                slots[i].i = int_val;
+            }
+        }
+
+        /* without group keys there is one entry, kept across rows */
+        if (entry == NULL || aggregate->nkeys > 0) {
+            agg_key(common, columns, cells, key);
+            entry = agg_table_entry(chunk->agg_table, key);
+        }
+        agg_combine(common, chunk->agg_table, entry, slots, counts);
+
+        rowp += row_width;
+    }
+
+    free(key);
+    free(counts);
+    free(slots);
+    free(cells);
+
+    if (common->stats != NULL) {
+        CHUNK_STATS(common, chunk)->nbytes = rowp - chunk->buf;
+        CHUNK_STATS(common, chunk)->nrows = chunk->nrows;
+    }
+
+    return 0;
+}
+
+static void
+aggregate_set_column(FastCsvAggregate *aggregate, const uchar *name, size_t len, int col_idx)
+{
+    int i;
+
+    for (i = 0; i < aggregate->nkeys + aggregate->naggs; i++) {
+        FastCsvAggColumn *agg_column = (i < aggregate->nkeys)
+            ? &aggregate->keys[i] : &aggregate->aggs[i - aggregate->nkeys];
+        /* NULL name to forget previous lookups */
+        if (agg_column->col_name != NULL
+            && (name == NULL
+                || (agg_column->col_idx < 0 && agg_column->col_name_len == len
+                    && memcmp(agg_column->col_name, name, len) == 0))) {
+            agg_column->col_idx = col_idx;
+        }
+    }
+}
+
+/* Check the aggregate against the resolved columns, and work out the
+   key and slot layout. */
+static int
+check_aggregate(ThreadCommon *common)
+{
+    const FastCsvAggregate *aggregate = common->aggregate;
+    int ncols = resolved_ncols(common);
+    int i;
+
+    common->agg_slot_types = (int *)malloc((aggregate->naggs + 1) * sizeof(int));
+    common->agg_key_space = 0;
+
+    for (i = 0; i < aggregate->nkeys + aggregate->naggs; i++) {
+        const FastCsvAggColumn *agg_column = (i < aggregate->nkeys)
+            ? &aggregate->keys[i] : &aggregate->aggs[i - aggregate->nkeys];
+        int is_key = (i < aggregate->nkeys);
+        int col_type;
+
+        if (!is_key && agg_column->op == AGG_COUNT) {
+            common->agg_slot_types[i - aggregate->nkeys] = COL_TYPE_INT64;
+            if (agg_column->col_idx < 0 && agg_column->col_name == NULL) {
+                continue;  /* count rows */
+            }
+        }
+        if (agg_column->col_idx < 0
+            || (ncols > 0 && agg_column->col_idx >= ncols)) {
+            return FASTCSV_ERR_AGG_COLUMN;
+        }
+
+        col_type = agg_column_type(common, agg_column->col_idx);
+        if (is_key) {
+            common->agg_key_space += agg_key_width(common, agg_column->col_idx);
+        } else if (agg_column->op == AGG_COUNT) {
+            /* any type */
+        } else if (col_type == COL_TYPE_STRING) {
+            return FASTCSV_ERR_AGG_TYPE;
+        } else {
+            common->agg_slot_types[i - aggregate->nkeys] =
+                (agg_column->op == AGG_MEAN) ? COL_TYPE_DOUBLE : col_type;
+        }
+
+        if (agg_column->col_idx >= common->agg_ncols) {
+            common->agg_ncols = agg_column->col_idx + 1;
+        }
+    }
+
+    /* whole words for agg_hash */
+    common->agg_key_space = (common->agg_key_space + 7) / 8 * 8;
+
+    return 0;
+}
+
+/* Merge the chunk tables, in chunk order, and add the output columns. */
+static int
+add_aggregates(ThreadCommon *common)
+{
+    const FastCsvAggregate *aggregate = common->aggregate;
+    AggTable table;
+    size_t ngroups, g;
+    size_t key_offset = 0;
+    int i;
+
+    agg_table_init(&table, common->agg_key_space, aggregate->naggs);
+
+    for (i = 0; i < common->nchunks; i++) {
+        AggTable *chunk_table = common->all_chunks[i].agg_table;
+        size_t j;
+        if (chunk_table == NULL) {
+            continue;
+        }
+        for (j = 0; j < chunk_table->nentries; j++) {
+            uchar *entry = AGG_ENTRY(chunk_table, j);
+            uchar *dest = agg_table_entry(&table, AGG_ENTRY_KEY(chunk_table, entry));
+            agg_combine(common, &table, dest, AGG_ENTRY_SLOTS(entry),
+                        AGG_ENTRY_COUNTS(chunk_table, entry));
+        }
+    }
+
+    ngroups = table.nentries;
+
+    for (i = 0; i < aggregate->nkeys; i++) {
+        int col_idx = aggregate->keys[i].col_idx;
+        int col_type = agg_column_type(common, col_idx);
+        size_t width = agg_key_width(common, col_idx);
+        uchar *xs = (uchar *)call_add_column(common, col_type, ngroups,
+                                             (col_type == COL_TYPE_STRING) ? width : 0);
+        if (xs == NULL) {
+            agg_table_free(&table);
+            return -1;
+        }
+        for (g = 0; g < ngroups; g++) {
+            memcpy(xs + g * width, AGG_ENTRY_KEY(&table, AGG_ENTRY(&table, g)) + key_offset,
+                   width);
+        }
+        key_offset += width;
+    }
+
+    for (i = 0; i < aggregate->naggs; i++) {
+        int op = aggregate->aggs[i].op;
+        int col_type = (op == AGG_COUNT) ? COL_TYPE_INT64 : common->agg_slot_types[i];
+        uchar *xs = (uchar *)call_add_column(common, col_type, ngroups, 0);
+        if (xs == NULL) {
+            agg_table_free(&table);
+            return -1;
+        }
+        for (g = 0; g < ngroups; g++) {
+            uchar *entry = AGG_ENTRY(&table, g);
+            int64_t count = AGG_ENTRY_COUNTS(&table, entry)[i];
+            if (op == AGG_COUNT) {
+                ((int64_t *)xs)[g] = count;
+            } else if (count == 0 && op != AGG_SUM) {
+                /* only nulls in the group */
+                if (col_type == COL_TYPE_DOUBLE) {
+                    ((double *)xs)[g] = NAN;
+                } else {
+                    ((int64_t *)xs)[g] = common->missing_int_val;
+                }
+            } else if (op == AGG_MEAN) {
+                ((double *)xs)[g] = AGG_ENTRY_SLOTS(entry)[i].d / count;
+            } else if (col_type == COL_TYPE_DOUBLE) {
+                ((double *)xs)[g] = AGG_ENTRY_SLOTS(entry)[i].d;
+            } else {
+                ((int64_t *)xs)[g] = AGG_ENTRY_SLOTS(entry)[i].i;
+            }
+        }
+    }
+
+    agg_table_free(&table);
+
+    return 0;
+}
+
+/* The narrowest type for the column.  Cells of width w have fewer than w
+   digits, less if there is a sign or decimal point, so the width bounds
+   the values without converting them. */
+static int
+narrow_type(ThreadCommon *common, int col_type, width_t width, int has_expo)
+{
+    int64_t missing = common->missing_int_val;
+
+    if (col_type == COL_TYPE_INT64 && common->narrow != NARROW_OFF) {
+        if (width <= 2 && missing >= -128 && missing <= 127) {
+            return COL_TYPE_INT8;  /* -9 to 99 */
+        }
+        if (width <= 4 && missing >= -32768 && missing <= 32767) {
+            return COL_TYPE_INT16;  /* -999 to 9999 */
+        }
+        if (width <= 9 && missing >= INT_MIN && missing <= INT_MAX) {
+            return COL_TYPE_INT32;
+        }
+    }
+
+    /* at most 7 digits, so exact, or 6 significant digits after a point,
+       which float keeps */
+    if (col_type == COL_TYPE_DOUBLE && common->narrow == NARROW_AUTO
+        && width <= 7 && !has_expo) {
+        return COL_TYPE_FLOAT32;
+    }
+
+    return col_type;
+}
+
+/* Settle the type and width of each column, the same in every chunk. */
+static int
+resolve_columns(ThreadCommon *common)
+{
+    Chunk *chunks = common->all_chunks;
+    int nchunks = common->nchunks;
+    int i;
+    int col_idx;
+    int ncols = 0;
+
+    for (i = 0; i < nchunks; i++) {
+        if (chunks[i].ncols > ncols) {
+            ncols = chunks[i].ncols;
+        }
+        chunks[i].nkeep = chunks[i].nrows;
+    }
+    if (common->schema != NULL) {
+        ncols = common->schema_ncols;
+    }
+
+    for (col_idx = 0; col_idx < ncols; col_idx++) {
+        int col_type, out_type;
+        int has_expo = 0;
+        int frac_digits = 0;
+        int scale = 0;
+        width_t width;
+
+        col_type = COL_TYPE_INT32;
+        width = 1;  /* numpy has minimum string len of 1 */
+        for (i = 0; i < nchunks; i++) {
+            Column *column;
+            if (col_idx >= chunks[i].ncols) {
+                continue;
+            }
+            column = &CHUNK_COLUMN(&chunks[i], col_idx);
+            if (column->type > col_type) {  /* "supertype" */
+                col_type = column->type;
+            }
+            if (column->width > width) {
+                width = column->width;
+            }
+            has_expo |= column->has_expo;
+            if (column->frac_digits > frac_digits) {
+                frac_digits = column->frac_digits;
+            }
+        }
+
+        if (common->schema != NULL) {
+            col_type = common->schema[col_idx].type;
+            if (common->schema[col_idx].width > 0) {
+                width = (width_t)common->schema[col_idx].width;
+            }
+        }
+
+        if (col_type == COL_TYPE_STRING && common->stats != NULL) {
+            common->stats->n_string_cols++;
+        }
+
+        out_type = (common->schema != NULL) ? col_type
+            : narrow_type(common, col_type, width, has_expo);
+
+        if (common->result->fix_column_type != NULL) {
+            out_type = common->result->fix_column_type(common->result, col_idx, out_type);
+        }
+
+        /* parse the output types as the wider type */
+        if (out_type == COL_TYPE_INT8 || out_type == COL_TYPE_INT16) {
+            col_type = COL_TYPE_INT64;
+        } else if (out_type == COL_TYPE_FLOAT32) {
+            col_type = COL_TYPE_DOUBLE;
+        } else if (out_type == COL_TYPE_DECIMAL) {
+            col_type = COL_TYPE_DOUBLE;
+            scale = frac_digits;
+            if (common->result->fix_decimal_scale != NULL) {
+                scale = common->result->fix_decimal_scale(common->result, col_idx, frac_digits);
+            }
+            if (scale < 0) {
+                scale = 0;
+            } else if (scale > DECIMAL_MAX_SCALE) {
+                scale = DECIMAL_MAX_SCALE;
+            }
+        } else {
+            col_type = out_type;
+        }
+
+        /* make the column the same type in each chunk */
+        for (i = 0; i < nchunks; i++) {
+            Column *column;
+            array_buf_enlarge(&chunks[i].columns, ncols * sizeof(Column));
+            column = &CHUNK_COLUMN(&chunks[i], col_idx);
+            if (col_idx >= chunks[i].ncols) {
+                column->first_row = 0;
+                column->nquoted = 0;
+            }
+            column->type = col_type;
+            column->out_type = out_type;
+            column->scale = scale;
+            column->width = width;
+            column->spill_size = 0;
+        }
+    }
+
+    /* Give each chunk the same number of columns */
+    for (i = 0; i < nchunks; i++) {
+        chunks[i].ncols = ncols;
+    }
+
+    return 0;
+}
+
+#ifndef _WIN32
+/* Allocate size bytes of blocks for fd, returning 0 on success. */
+static int
+reserve_file(int fd, size_t size)
+{
+#ifdef __APPLE__
+    fstore_t store;
+
+    store.fst_flags = F_ALLOCATEALL;
+    store.fst_posmode = F_PEOFPOSMODE;
+    store.fst_offset = 0;
+    store.fst_length = (off_t)size;
+    store.fst_bytesalloc = 0;
+    if (fcntl(fd, F_PREALLOCATE, &store) == -1) {
+        return -1;
+    }
+    return ftruncate(fd, (off_t)size);
+#else
+    return posix_fallocate(fd, 0, size);
+#endif
+}
+
+/* size bytes mapped from an unlinked file in dir, or NULL. */
+static void *
+map_spill_file(const char *dir, size_t size)
+{
+    char *path;
+    int fd;
+    void *data;
+
+    if (dir == NULL && (dir = getenv("TMPDIR")) == NULL) {
+        dir = "/tmp";
+    }
+    path = (char *)malloc(strlen(dir) + 20);
+    sprintf(path, "%s/camog-XXXXXX", dir);
+    fd = mkstemp(path);
+    if (fd >= 0) {
+        unlink(path);
+    }
+    free(path);
+    if (fd < 0) {
+        return NULL;
+    }
+
+    /* allocate the blocks now, rather than SIGBUS when the disk is full */
+    data = NULL;
+    if (reserve_file(fd, size) == 0) {
+        data = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (data == MAP_FAILED) {
+            data = NULL;
+        }
+    }
+    close(fd);
+
+    return data;
+}
+#endif
+
+/* A mapped column, or NULL to use add_column. */
+static uchar *
+spill_column(ThreadCommon *common, int col_type, size_t nrows, size_t width, size_t size)
+{
+#ifndef _WIN32
+    uchar *xs;
+
+    if (common->release_rows == 0 || nrows == 0
+        || (xs = (uchar *)map_spill_file(common->spill_dir, nrows * size)) == NULL) {
+        return NULL;
+    }
+    if (common->result->add_mapped_column(common->result, col_type, nrows, width,
+                                          xs, nrows * size) != 0) {
+        munmap(xs, nrows * size);
+        return NULL;
+    }
+    return xs;
+#else
+    return NULL;
+#endif
+}
+
+/* If the columns and the stage 1 buffers would go over memory_limit, set
+   release_rows so each thread keeps about a quarter of the limit of
+   mapped rows at a time. */
+static void
+plan_spill(ThreadCommon *common, int nrows)
+{
+    Chunk *chunks = common->all_chunks;
+    int ncols = chunks[0].ncols;
+    size_t row_size = 0;
+    size_t total;
+    int i, col_idx;
+
+    if (common->memory_limit == 0 || common->result->add_mapped_column == NULL
+        || common->partition != NULL) {
+        return;  /* partitioned rows are not filled in order */
+    }
+
+    for (col_idx = 0; col_idx < ncols; col_idx++) {
+        const Column *column = &CHUNK_COLUMN(&chunks[0], col_idx);
+        row_size += (column->out_type == COL_TYPE_STRING) ? column->width
+            : col_type_size(column->out_type);
+    }
+    total = nrows * row_size;
+    for (i = 0; i < common->nchunks; i++) {
+        total += chunks[i].nrows * (sizeof(width_t) + (chunks[i].keep != NULL))
+            + chunks[i].ncols * sizeof(Column);
+    }
+
+    if (total > common->memory_limit && row_size > 0) {
+        size_t rows = common->memory_limit / 4 / common->nthreads / row_size;
+        common->release_rows = (rows < 1) ? 1 : (rows > INT_MAX) ? INT_MAX : (int)rows;
+    }
+}
+
+/* Only the rows kept by the filter get space. */
+static int
+allocate_arrays(ThreadCommon *common)
+{
+    Chunk *chunks = common->all_chunks;
+    int nchunks = common->nchunks;
+    int i;
+    int col_idx;
+    int ncols = nchunks > 0 ? chunks[0].ncols : 0;
+    int nrows = 0;
+    int n_str_cols = 0;
+
+    for (i = 0; i < nchunks; i++) {
+        nrows += chunks[i].nkeep;
+    }
+
+    common->str_idxs = (int *)malloc(ncols * sizeof(int));
+
+    if (ncols > 0) {
+        plan_spill(common, nrows);
+    }
+
+    for (col_idx = 0; col_idx < ncols; col_idx++) {
+        uchar *xs;
+        int col_type = CHUNK_COLUMN(&chunks[0], col_idx).out_type;
+        width_t width = CHUNK_COLUMN(&chunks[0], col_idx).width;
+
+        if (col_type != COL_TYPE_STRING) {
+            size_t size = col_type_size(col_type);
+            width_t spill_size = size;
+            if ((xs = spill_column(common, col_type, nrows, 0, size)) == NULL) {
+                if ((xs = (uchar *)call_add_column(common, col_type, nrows, 0)) == NULL) {
+                    return -1;
+                }
+                spill_size = 0;
+            }
+            for (i = 0; i < nchunks; i++) {
+                CHUNK_COLUMN(&chunks[i], col_idx).arr_ptr = xs;
+                CHUNK_COLUMN(&chunks[i], col_idx).spill_size = spill_size;
+                xs += chunks[i].nkeep * size;
+            }
+        } else {
+#if NUMPY_STRING_OBJECT
+            arr = PyArray_SimpleNew(1, dims, NPY_OBJECT);
+            xs = (uchar *)PyArray_DATA((PyArrayObject *)arr);
+            for (i = 0; i < nrows; i++) {
+                /* PyString_FromStringAndSize is not thread-safe. */
+                ((PyObject **)xs)[i] = PyString_FromStringAndSize(NULL, width);
+            }
+            for (i = 0; i < nchunks; i++) {
+                CHUNK_COLUMN(&chunks[i], col_idx).arr_ptr = xs;
+                xs += chunks[i].nkeep * sizeof(PyObject *);
+            }
+#else
+            width_t spill_size = width;
+            if ((xs = spill_column(common, col_type, nrows, width, width)) == NULL) {
+                if ((xs = (uchar *)call_add_column(common, col_type, nrows, width)) == NULL) {
+                    return -1;
+                }
+                spill_size = 0;
+            }
+            for (i = 0; i < nchunks; i++) {
+                CHUNK_COLUMN(&chunks[i], col_idx).arr_ptr = xs;
+                CHUNK_COLUMN(&chunks[i], col_idx).spill_size = spill_size;
+                xs += chunks[i].nkeep * width;
+            }
+#endif
+            common->str_idxs[n_str_cols] = col_idx;
+            n_str_cols++;
+        }
+        if (common->partition != NULL) {
+            /* partitioned rows go anywhere in the column */
+            for (i = 1; i < nchunks; i++) {
+                CHUNK_COLUMN(&chunks[i], col_idx).arr_ptr =
+                    CHUNK_COLUMN(&chunks[0], col_idx).arr_ptr;
+            }
+        }
+    }
+
+    common->n_str_cols = n_str_cols;
+
+    return 0;
+}
+
+/* Merge the chunk accumulators into common->summary. */
+static int
+summarize_columns(ThreadCommon *common)
+{
+    FastCsvSummary *summary = common->summary;
+    int ncols = common->all_chunks[0].ncols;
+    uchar *hll;
+    int i, col_idx, j;
+
+    summary->ncols = ncols;
+    summary->columns = (FastCsvColumnStats *)calloc(ncols + 1, sizeof(FastCsvColumnStats));
+    hll = (uchar *)malloc(HLL_SIZE);
+
+    for (col_idx = 0; col_idx < ncols; col_idx++) {
+        FastCsvColumnStats *col_stats = &summary->columns[col_idx];
+
+        col_stats->type = CHUNK_COLUMN(&common->all_chunks[0], col_idx).type;
+        if (CHUNK_COLUMN(&common->all_chunks[0], col_idx).out_type == COL_TYPE_DECIMAL) {
+            col_stats->type = COL_TYPE_DECIMAL;  /* int fields, times 10 ** scale */
+        }
+        memset(hll, 0, HLL_SIZE);
+
+        for (i = 0; i < common->nchunks; i++) {
+            const ColumnAcc *acc;
+            if (common->all_chunks[i].col_accs == NULL) {
+                continue;
+            }
+            acc = &common->all_chunks[i].col_accs[col_idx];
+            if (acc->count > 0) {
+                if (col_stats->count == 0 || acc->int_min < col_stats->int_min) {
+                    col_stats->int_min = acc->int_min;
+                }
+                if (col_stats->count == 0 || acc->int_max > col_stats->int_max) {
+                    col_stats->int_max = acc->int_max;
+                }
+                if (col_stats->count == 0 || acc->float_min < col_stats->float_min) {
+                    col_stats->float_min = acc->float_min;
+                }
+                if (col_stats->count == 0 || acc->float_max > col_stats->float_max) {
+                    col_stats->float_max = acc->float_max;
+                }
+            }
+            col_stats->int_sum += acc->int_sum;
+            col_stats->float_sum += acc->float_sum;
+            col_stats->count += acc->count;
+            col_stats->nulls += acc->nulls;
+            col_stats->nans += acc->nans;
+            for (j = 0; j < HLL_SIZE; j++) {
+                if (acc->hll[j] > hll[j]) {
+                    hll[j] = acc->hll[j];
+                }
+            }
+        }
+
+        col_stats->ndistinct = (col_stats->count == 0) ? 0.0 : hll_estimate(hll);
+    }
+
+    free(hll);
+
+    return 0;
+}
+
+/* Gather the chunk null bits into a validity bitmap for each column
+   that has nulls. */
+static int
+add_validity_bitmaps(ThreadCommon *common)
+{
+    Chunk *chunks = common->all_chunks;
+    int nchunks = common->nchunks;
+    int ncols = resolved_ncols(common);
+    size_t nrows = 0;
+    int col_idx, i;
+
+    for (i = 0; i < nchunks; i++) {
+        nrows += chunks[i].nkeep;
+    }
+
+    for (col_idx = 0; col_idx < ncols; col_idx++) {
+        uchar *bitmap;
+        size_t first_row;
+
+        for (i = 0; i < nchunks; i++) {
+            if (chunks[i].null_bits != NULL && chunks[i].null_bits[col_idx] != NULL) {
+                break;
+            }
+        }
+        if (i == nchunks) {
+            continue;  /* all valid */
+        }
+
+        bitmap = common->result->add_validity(common->result, col_idx, nrows);
+        if (bitmap == NULL) {
+            return -1;
+        }
+        memset(bitmap, 0xff, nrows / 8);
+        if (nrows & 7) {
+            bitmap[nrows / 8] = (1 << (nrows & 7)) - 1;
+        }
+
+        first_row = 0;
+        for (i = 0; i < nchunks; i++) {
+            const uchar *bits = (chunks[i].null_bits != NULL) ? chunks[i].null_bits[col_idx] : NULL;
+            size_t j;
+
+            if (bits != NULL) {
+                for (j = 0; j < (size_t)(chunks[i].nkeep + 7) / 8; j++) {
+                    int k;
+                    if (bits[j] == 0) {
+                        continue;
+                    }
+                    for (k = 0; k < 8; k++) {
+                        if (bits[j] & (1 << k)) {
+                            size_t row = first_row + j * 8 + k;
+                            bitmap[row >> 3] &= ~(1 << (row & 7));
+                        }
+                    }
+                }
+            }
+            first_row += chunks[i].nkeep;
+        }
+    }
+
+    return 0;
+}
+
+void
+free_csv_summary(FastCsvSummary *summary)
+{
+    free(summary->columns);
+}
+
+static int
+parse_stage1(ThreadCommon *common, Chunk *chunk)
+{
+    const uchar *buf = chunk->buf;
+    const uchar *buf_end = chunk->buf_end;
+    const uchar *soft_end = chunk->soft_end;  /* can go past this in middle of line */
+    const uchar sep = common->sep;
+    LinkedBuf *offset_buf = &chunk->offset_buf;
+    Column *columns = &CHUNK_COLUMN(chunk, 0);
+    const uchar *p = buf;
+    const uchar *cellp = NULL;
+    const uchar *rowp = buf;
+    int col_idx = 0, row_idx = -1;  /* currently not parsing a row */
+    int ncols = 0;
+    uchar c = 0;
+
+    LINKED_INIT(offset_buf, width_t);
+
+    if (chunk->chunk_idx > 0) {
+        while (1) {
+            if (p >= buf_end) {
+                chunk->buf = p;
+                goto finished;  /* just exit nicely */
+            }
+            c = *p++;
+            if (c == '\n') {
+                break;
+            }
+        }
+        chunk->buf = p;
+        if (p > soft_end) {  /* newline (ie. p-1) >= soft_end */
+            goto finished;
+        }
+    }
+
+    rowp = p;
+    row_idx = 0;
+
+    if (common->schema != NULL && !common->schema_widths) {
+        /* the schema has the columns, so only the rows are needed */
+        while (1) {
+            p = find_row_end(p, buf_end, sep);
+            if (p >= buf_end) {
+                goto athardend;
+            }
+            LINKED_PUT(offset_buf, width_t, (width_t)(p - rowp + 1));
+            if (p >= soft_end) {
+                goto finished;
+            }
+            row_idx++;
+            rowp = ++p;
+        }
+    }
+
+    while (1) {
+        /* Start of cell */
+
+        width_t width = 0;
+        int nquotes = 0;
+        int frac_digits = 0;
+        int col_type;
+        int cell_type;  /* before this cell */
+        const uchar *cell_begin;
+        int digit;
+#ifdef WITH_NUMIDX
+        size_t numidx;
+#endif
+
+        if (col_idx >= ncols) {
+            ncols++;
+            columns = (Column *)array_buf_enlarge(&chunk->columns, ncols * sizeof(Column));
+            /* with a schema, only the string widths are needed */
+            COLUMN_INIT(&CHUNK_COLUMN(chunk, col_idx), row_idx,
+                        (common->schema != NULL) ? COL_TYPE_STRING : COL_TYPE_INT64);
+        }
+        if (p >= buf_end) {
+            goto athardend;
+        }
+
+        cellp = cell_begin = p;
+
+        col_type = cell_type = CHUNK_COLUMN(chunk, col_idx).type;
+
+        c = *p;
+
+        if (col_type == COL_TYPE_STRING) {
+            goto parsestring;
+        }
+
+        if (c == '"') {
+            ++nquotes;
+            ++cellp;
+            columns[col_idx].nquoted++;
+            if (!(common->flags & FLAG_EXCEL_QUOTES)) {
+                goto bad;
+            }
+            NEXTCHAR_INQUOTES(goodend);
+
+#include "parser_inquotes.h"
+
+        } else {
+
+#include "parser.h"
+
+        }
+
+        if (nquotes != 1) {  /* c not in quotes */
+            if (c == '\r') {
+                ++cellp;  /* make width smaller */
+                NEXTCHAR_NOQUOTES(goodend);
+            }
+
+            if (c == sep || c == '\n') {
+                goto comma;
+            }
+        }
+    bad:
+        if (common->n_na_tokens > 0 && cell_is_na(common, cell_begin, buf_end)) {
+            goto nacell;
+        }
+        columns[col_idx].type = COL_TYPE_STRING;
+        goto atstringbegin;
+
+    badend:
+        if (common->n_na_tokens > 0 && cell_is_na(common, cell_begin, buf_end)) {
+            goto nacell;
+        }
+        columns[col_idx].type = COL_TYPE_STRING;
+        goto comma;
+
+    nacell:
+        /* missing, so the column keeps its type, eg. "." is not a double */
+        columns[col_idx].type = cell_type;
+        frac_digits = 0;
+        p = skip_cell(cell_begin, buf_end, sep);
+        if (p < buf_end) {
+            c = *p;
+        }
+        goto comma;
+
+    parsestring:
+        if (c == '"') {
+            ++cellp;
+            ++nquotes;
+            columns[col_idx].nquoted++;
+        }
+
+    atstringbegin:
+        if (nquotes == 1) {
+            while (1) {
+                if (c == '\r') {
+                    ++cellp;  /* make width smaller */
+                }
+                p = find_quote(p + 1, buf_end);
+                if (p >= buf_end) {
+                    goto comma;
+                }
+                c = *p;
+                if (c == '"') {
+                    ++cellp;
+                    ++p;
+                    if (p >= buf_end) {
+                        goto comma;
+                    }
+                    c = *p;
+                    if (c != '"') {
+                        ++nquotes;
+                        break;
+                    }
+                }
+            }
+        }
+
+        /* c is first char of string here */
+        while (1) {
+            if (c == sep || c == '\n') {
+                break;
+            }
+            if (c == '\r') {
+                ++cellp;  /* make width smaller */
+            }
+            p = find_cell_end(p + 1, buf_end, sep);
+            if (p >= buf_end) {
+                break;
+            }
+            c = *p;
+        }
+
+    goodend:
+    comma:
+        width = (width_t)(p - cellp);
+        if (width > columns[col_idx].width) {
+            columns[col_idx].width = width;
+        }
+        if (frac_digits > columns[col_idx].frac_digits) {
+            columns[col_idx].frac_digits = frac_digits;
+        }
+
+        if (p >= buf_end) {
+            goto athardend;
+        }
+
+        if (c == '\n') {
+            LINKED_PUT(offset_buf, width_t, (width_t)(p - rowp + 1));
+
+            if (p >= soft_end) {  /* newline (ie. p) >= soft_end */
+                /* break out before we get set for new row */
+                goto finished;
+            }
+
+            col_idx = 0;
+            row_idx++;
+            rowp = p + 1;
+        } else {
+            col_idx++;
+        }
+        p++;
+    }
+
+ athardend:
+
+    /* pretend separator for consistency */
+    LINKED_PUT(offset_buf, width_t, (width_t)(p - rowp + 1));
+
+    /* empty last line? */
+    if (p == rowp) {
+        row_idx--;
+    }
+
+ finished:
+
+    chunk->ncols = ncols;
+    chunk->nrows = row_idx + 1;
+    chunk->found_end = p;
+
+    return 0;
+}
+
+static int
+fixup_parse(ThreadCommon *common, int buf_idx)
+{
+    Chunk *bigchunk;
+    LinkedLink *offset_link;
+    uchar *offset_ptr;
+    const uchar *rowp;
+    int first_row;
+    int first = common->buf_chunks[buf_idx];
+    int last = common->buf_chunks[buf_idx + 1];
+    int i, previ;
+
+    previ = first;
+    for (i = first + 1; ; i++) {
+        if (i >= last) {
+            return 0;
+        }
+        if (common->all_chunks[i].nrows == 0) {
+            continue;  /* empty chunk */
+        }
+        if (common->all_chunks[previ].found_end + 1 != common->all_chunks[i].buf) {
+            break;
+        }
+        previ = i;
+    }
+
+    bigchunk = (Chunk *)malloc(sizeof(Chunk));
+    common->bigchunks[buf_idx] = bigchunk;
+
+    /* fix everything from chunk[i] onward */
+    bigchunk->chunk_idx = i - first;
+    bigchunk->buf = common->all_chunks[previ].found_end;
+    bigchunk->soft_end = common->all_chunks[previ].buf_end;
+    bigchunk->buf_end = common->all_chunks[previ].buf_end;
+    bigchunk->keep = NULL;
+    bigchunk->parts = NULL;
+    bigchunk->part_out = NULL;
+    bigchunk->part_end = NULL;
+    bigchunk->agg_table = NULL;
+    bigchunk->col_accs = NULL;
+    bigchunk->null_bits = NULL;
+    array_buf_init(&bigchunk->columns);
+
+    parse_stage1(common, bigchunk);
+
+    if (common->stats != NULL) {
+        common->stats->fixup_bytes += bigchunk->found_end - bigchunk->buf;
+        common->stats->nchunks_reparsed += last - i;
+    }
+
+    offset_link = bigchunk->offset_buf.first;
+    offset_ptr = offset_link->data;
+    rowp = bigchunk->buf;
+
+    first_row = 0;
+    for ( ; i < last; i++) {
+        Chunk *chunk = &common->all_chunks[i];
+        int nrows = 0, ncols = 0;
+        int col_idx;
+
+        linked_free(&chunk->offset_buf);
+
+        chunk->buf = rowp;
+        chunk->offset_buf.own_data = 0;
+        chunk->offset_buf.first = offset_link;
+        chunk->offset_buf.first_data = offset_ptr;
+
+        while (rowp < chunk->soft_end) {
+            rowp += *((width_t *)offset_ptr);
+            LINKED_NEXT(offset_link, offset_ptr, width_t);
+            nrows++;
+        }
+
+        chunk->nrows = nrows;
+
+        for (col_idx = 0; col_idx < bigchunk->ncols; col_idx++) {
+            Column *bigcolumn = &CHUNK_COLUMN(bigchunk, col_idx);
+            Column *column;
+
+            if (bigcolumn->first_row >= first_row + nrows) {
+                break;
+            }
+
+            array_buf_enlarge(&chunk->columns, (col_idx + 1) * sizeof(Column));
+
+            column = &CHUNK_COLUMN(chunk, col_idx);
+
+            column->type = bigcolumn->type;
+            column->width = bigcolumn->width;
+            column->has_expo = bigcolumn->has_expo;
+            column->frac_digits = bigcolumn->frac_digits;
+            if (bigcolumn->first_row >= first_row) {
+                /* counted once, in the chunk where the column begins */
+                column->first_row = bigcolumn->first_row - first_row;
+                column->nquoted = bigcolumn->nquoted;
+            } else {
+                column->first_row = 0;
+                column->nquoted = 0;
+            }
+
+            ncols++;
+        }
+
+        chunk->ncols = ncols;
+        first_row += nrows;
+    }
+
+    return 0;
+}
+
+static const char digit_pairs[] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+/* Two digits at a time, from the right. */
+static uchar *
+format_int(uchar *q, int64_t value)
+{
+    uchar tmp[20];
+    uchar *t = tmp + sizeof(tmp);
+    uint64_t u;
+    int d;
+
+    if (value < 0) {
+        *q++ = '-';
+        u = -(uint64_t)value;
+    } else {
+        u = (uint64_t)value;
+    }
+
+    while (u >= 100) {
+        d = (int)(u % 100) * 2;
+        u /= 100;
+        t -= 2;
+        t[0] = digit_pairs[d];
+        t[1] = digit_pairs[d + 1];
+    }
+    if (u >= 10) {
+        d = (int)u * 2;
+        t -= 2;
+        t[0] = digit_pairs[d];
+        t[1] = digit_pairs[d + 1];
+    } else {
+        *--t = (uchar)('0' + u);
+    }
+
+    memcpy(q, t, tmp + sizeof(tmp) - t);
+    return q + (tmp + sizeof(tmp) - t);
+}
+
+/* The shortest of 15, 16 or 17 significant digits (6 to 9 for floats)
+   that reads back the same, with a point or exponent so it reads back as
+   a float column.  The point is always '.', whatever LC_NUMERIC says. */
+static uchar *
+format_double(uchar *q, double val, int is_float)
+{
+    char tmp[32];
+    int prec = is_float ? 6 : 15;
+    int max_prec = is_float ? 9 : 17;
+    int n, i;
+    uchar *q_begin = q;
+
+    if (val != val) {
+        memcpy(q, "nan", 3);
+        return q + 3;
+    }
+    if (val == INFINITY || val == -INFINITY) {
+        if (val < 0) {
+            *q++ = '-';
+        }
+        memcpy(q, "inf", 3);
+        return q + 3;
+    }
+
+    /* exact, and much faster than sprintf */
+    if (val > -1e15 && val < 1e15 && val == (double)(int64_t)val) {
+        if (val == 0.0 && signbit(val)) {
+            *q++ = '-';
+        }
+        q = format_int(q, (int64_t)val);
+        *q++ = '.';
+        *q++ = '0';
+        return q;
+    }
+
+    for (; ; prec++) {
+        n = sprintf(tmp, "%.*g", prec, val);
+        if (prec == max_prec
+            || (is_float ? strtof(tmp, NULL) == (float)val : strtod(tmp, NULL) == val)) {
+            break;
+        }
+    }
+
+    /* sprintf and strtod agree on the locale's point, which may be ',' or
+       more than one byte, but %g writes nothing else that is not a digit,
+       sign or exponent */
+    for (i = 0; i < n; i++) {
+        char ch = tmp[i];
+        if ((ch >= '0' && ch <= '9') || ch == '-' || ch == '+' || ch == 'e') {
+            *q++ = ch;
+        } else if (q == q_begin || q[-1] != '.') {
+            *q++ = '.';
+        }
+    }
+    for (i = 0; q_begin + i < q; i++) {
+        if (q_begin[i] == '.' || q_begin[i] == 'e') {
+            return q;
+        }
+    }
+    *q++ = '.';
+    *q++ = '0';
+    return q;
+}
+
+static uchar *
+format_string(uchar *q, const uchar *str, size_t len, uchar sep)
+{
+    size_t i;
+
+    for (i = 0; i < len; i++) {
+        uchar c = str[i];
+        if (c == sep || c == '"' || c == '\n' || c == '\r') {
+            break;
+        }
+    }
+    if (i == len) {
+        memcpy(q, str, len);
+        return q + len;
+    }
+
+    *q++ = '"';
+    for (i = 0; i < len; i++) {
+        if (str[i] == '"') {
+            *q++ = '"';
+        }
+        *q++ = str[i];
+    }
+    *q++ = '"';
+    return q;
+}
+
+/* Longest a cell can be once formatted. */
+static size_t
+format_width(const FastCsvColumn *column)
+{
+    switch (column->type) {
+    case COL_TYPE_STRING:
+        return column->width * 2 + 2;
+    case COL_TYPE_DOUBLE:
+    case COL_TYPE_FLOAT32:
+        return 32;
+    default:
+        return 20;
+    }
+}
+
+static int
+format_rows(WriteChunk *chunk)
+{
+    const FastCsvOutput *output = chunk->output;
+    size_t row_width = 0;
+    size_t cap, row;
+    uchar *q;
+    int col_idx;
+
+    for (col_idx = 0; col_idx < output->ncols; col_idx++) {
+        row_width += format_width(&output->columns[col_idx]) + 1;
+    }
+
+    cap = (chunk->end_row - chunk->begin_row) * output->ncols * 8 + row_width;
+    chunk->buf = (uchar *)malloc(cap);
+    q = chunk->buf;
+
+    for (row = chunk->begin_row; row < chunk->end_row; row++) {
+        if ((size_t)(q - chunk->buf) + row_width > cap) {
+            size_t len = q - chunk->buf;
+            cap = cap * 2 + row_width;
+            chunk->buf = (uchar *)realloc(chunk->buf, cap);
+            q = chunk->buf + len;
+        }
+
+        for (col_idx = 0; col_idx < output->ncols; col_idx++) {
+            const FastCsvColumn *column = &output->columns[col_idx];
+            const uchar *str, *end;
+
+            if (col_idx > 0) {
+                *q++ = output->sep;
+            }
+            if (column->validity != NULL
+                && !(column->validity[row >> 3] & (1 << (row & 7)))) {
+                continue;
+            }
+
+            switch (column->type) {
+            case COL_TYPE_INT8:
+                q = format_int(q, ((const int8_t *)column->data)[row]);
+                break;
+            case COL_TYPE_INT16:
+                q = format_int(q, ((const int16_t *)column->data)[row]);
+                break;
+            case COL_TYPE_INT32:
+                q = format_int(q, ((const int32_t *)column->data)[row]);
+                break;
+            case COL_TYPE_INT64:
+                q = format_int(q, ((const int64_t *)column->data)[row]);
+                break;
+            case COL_TYPE_FLOAT32:
+                q = format_double(q, ((const float *)column->data)[row], 1);
+                break;
+            case COL_TYPE_DOUBLE:
+                q = format_double(q, ((const double *)column->data)[row], 0);
+                break;
+            default:
+                str = (const uchar *)column->data + row * column->width;
+                end = (const uchar *)memchr(str, 0, column->width);
+                q = format_string(q, str, (end == NULL) ? column->width : (size_t)(end - str),
+                                  output->sep);
+                break;
+            }
+        }
+        *q++ = '\n';
+    }
+
+    chunk->len = q - chunk->buf;
+
+    return 0;
+}
+
+/* Ask for the next buffer to be read in while this one is parsed, if the
+   chunk is the first of its buffer. */
+static void
+read_ahead(ThreadCommon *common, Chunk *chunk)
+{
+#ifndef _WIN32
+    int chunk_pos = (int)(chunk - common->all_chunks);
+    int i;
+
+    for (i = 0; i + 1 < common->nbufs && common->buf_chunks[i] <= chunk_pos; i++) {
+        if (common->buf_chunks[i] == chunk_pos && common->inputs[i + 1].buf_len > 0) {
+            madvise((void *)common->inputs[i + 1].csv_buf, common->inputs[i + 1].buf_len,
+                    MADV_WILLNEED);
+            break;
+        }
+    }
+#endif
+}
+
+static void
+run_job(ThreadData *thread_data)
+{
+    ThreadCommon *common = thread_data->common;
+    Chunk *chunk = thread_data->chunk;
+
+    switch (thread_data->stage) {
+    case 1:
+        if ((common->flags & FLAG_READ_AHEAD) && chunk->chunk_idx == 0) {
+            read_ahead(common, chunk);
+        }
+        parse_stage1(common, chunk);
+        break;
+    case 2:
+        if (common->aggregate != NULL) {
+            aggregate_rows(common, chunk);
+        } else if (common->fill_kernel >= 0) {
+            fill_kernels[common->fill_kernel].fill(common, chunk);
+        } else {
+            fill_arrays(common, chunk);
+        }
+        break;
+    case 3:
+        if (common->filter != NULL) {
+            filter_rows(common, chunk);
+        }
+        if (common->partition != NULL) {
+            partition_rows(common, chunk);
+        }
+        break;
+    case 4:
+        format_rows(thread_data->write_chunk);
+        break;
+    case 5:
+        fill_column(common, chunk);
+        break;
+    }
+}
+
+#ifdef _WIN32
+static unsigned int __stdcall
+#else
+static void *
+#endif
+parse_thread(void *data)
+{
+    Worker *worker = (Worker *)data;
+    Reader *reader = worker->reader;
+
+    while (1) {
+        double wait_begin = clock_now();
+
+        ThreadData *thread_data = queue_pop(&reader->inqueue);
+
+        ThreadCommon *common = thread_data->common;
+
+        Chunk *chunk = thread_data->chunk;
+
+        double begin = 0.0;
+
+        if (thread_data->stage == 4) {
+            run_job(thread_data);
+            queue_push(&reader->outqueue, thread_data);
+            continue;
+        }
+
+        if (common->stats != NULL) {
+            begin = clock_now() - common->t0;
+            wait_begin -= common->t0;
+            if (wait_begin < 0.0) {
+                wait_begin = 0.0;  /* was idle before this parse */
+            }
+        }
+
+        run_job(thread_data);
+
+        if (common->stats != NULL) {
+            FastCsvChunkStats *chunk_stats = CHUNK_STATS(common, chunk);
+            double end = clock_now() - common->t0;
+            if (thread_data->stage == 1) {
+                chunk_stats->stage1_thread = worker->thread_idx;
+                chunk_stats->stage1_wait = begin - wait_begin;
+                chunk_stats->stage1_begin = begin;
+                chunk_stats->stage1_end = end;
+            } else if (thread_data->stage == 2) {
+                chunk_stats->fill_thread = worker->thread_idx;
+                chunk_stats->fill_wait = begin - wait_begin;
+                chunk_stats->fill_begin = begin;
+                chunk_stats->fill_end = end;
+            }
+        }
+
+        queue_push(&reader->outqueue, thread_data);
+    }
+
+#ifdef _WIN32
+    return 0;
+#else
+    return NULL;
+#endif
+}
+
+static const uchar *
+parse_headers(ThreadCommon *common, const uchar *csv_buf, const uchar *buf_end,
+              int add_headers)
+{
+    const uchar *p = csv_buf;
+    uchar *cellbuf, *new_cellbuf, *q;
+    size_t cell_space;
     uchar sep = common->sep;
     uchar c = 0;
+    int col_idx = 0;
 
     cell_space = 256;
     cellbuf = (uchar *)malloc(cell_space);
@@ -933,188 +3597,828 @@ parse_headers(ThreadCommon *common, const uchar *csv_buf, const uchar *buf_end)
                 }
                 *q++ = c;
                 if (q >= cellbuf + cell_space) {
+                    new_cellbuf = realloc(cellbuf, cell_space * 2);
+                    q = new_cellbuf + cell_space;  /* buffer was full */
+                    cellbuf = new_cellbuf;
                     cell_space *= 2;
-                    new_cellbuf = realloc(cellbuf, cell_space);
-                    q = new_cellbuf + (q - cellbuf);
+                }
+            }
+        }
+        /* c is non-quoted char here */
+        while (c != sep && c != '\n') {
+            if (c != '\r') {
+                *q++ = c;
+                if (q >= cellbuf + cell_space) {
+                    new_cellbuf = realloc(cellbuf, cell_space * 2);
+                    q = new_cellbuf + cell_space;  /* buffer was full */
                     cellbuf = new_cellbuf;
+                    cell_space *= 2;
                 }
             }
+            ++p;
+            if (p >= buf_end) {
+                goto atstringend;
+            }
+            c = *p;
+        }
+    atstringend:
+        if (add_headers
+            && common->result->add_header(common->result, cellbuf, q - cellbuf)) {
+            free(cellbuf);
+            return NULL;
+        }
+        if (add_headers && common->filter != NULL) {
+            filter_set_column(common->filter, cellbuf, q - cellbuf, col_idx);
+        }
+        if (add_headers && common->aggregate != NULL) {
+            aggregate_set_column(common->aggregate, cellbuf, q - cellbuf, col_idx);
+        }
+        if (add_headers && common->partition != NULL) {
+            partition_set_column(common->partition, cellbuf, q - cellbuf, col_idx);
+        }
+        col_idx++;
+
+        if (p >= buf_end) {
+            break;
+        }
+        ++p;
+    }
+
+    free(cellbuf);
+
+    return p;
+}
+
+int
+init_csv(FastCsvInput *input, const uchar *csv_buf, size_t buf_len,
+         int nheaders, int nthreads)
+{
+    input->csv_buf = csv_buf;
+    input->buf_len = buf_len;
+    input->nheaders = nheaders;
+    input->nthreads = nthreads;
+    input->sep = ',';
+    input->flags = 0;
+    input->missing_int_val = 0;
+    input->missing_float_val = NAN;
+    input->stats = NULL;
+    input->trace_filename = NULL;
+    input->filter = NULL;
+    input->partition = NULL;
+    input->aggregate = NULL;
+    input->summary = NULL;
+    input->n_na_tokens = 0;
+    input->na_tokens = NULL;
+    input->narrow = NARROW_OFF;
+    input->memory_limit = 0;
+    input->spill_dir = NULL;
+    input->schema_ncols = 0;
+    input->schema = NULL;
+
+    return 0;
+}
+
+static void
+trace_span(FILE *fp, const char *name, int tid, double begin, double end, int chunk_idx,
+           const FastCsvChunkStats *chunk_stats)
+{
+    fprintf(fp, ",\n{\"name\": \"%s\", \"ph\": \"X\", \"pid\": 1, \"tid\": %d, "
+            "\"ts\": %.3f, \"dur\": %.3f", name, tid, begin * 1e6, (end - begin) * 1e6);
+    if (chunk_stats != NULL) {
+        fprintf(fp, ", \"args\": {\"chunk\": %d, \"nbytes\": %lu, \"nrows\": %lu}",
+                chunk_idx, (unsigned long)chunk_stats->nbytes,
+                (unsigned long)chunk_stats->nrows);
+    }
+    fprintf(fp, "}");
+}
+
+int
+write_csv_trace(const FastCsvStats *stats, const char *fname)
+{
+    FILE *fp;
+    int i, max_thread = -1;
+
+    if ((fp = fopen(fname, "w")) == NULL) {
+        return -1;
+    }
+
+    /* main thread is tid 0, reader thread i is tid i + 1 */
+    fprintf(fp, "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n"
+            "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": 0, "
+            "\"args\": {\"name\": \"main\"}}");
+
+    trace_span(fp, "stage1", 0, stats->stage1_begin, stats->stage1_end, 0, NULL);
+    trace_span(fp, "fixup", 0, stats->fixup_begin, stats->fixup_end, 0, NULL);
+    trace_span(fp, "allocate", 0, stats->allocate_begin, stats->allocate_end, 0, NULL);
+    if (stats->filter_end > 0.0) {
+        trace_span(fp, "filter", 0, stats->filter_begin, stats->filter_end, 0, NULL);
+    }
+    trace_span(fp, "fill", 0, stats->fill_begin, stats->fill_end, 0, NULL);
+
+    for (i = 0; i < stats->nchunks; i++) {
+        const FastCsvChunkStats *c = &stats->chunks[i];
+        if (c->stage1_thread > max_thread) {
+            max_thread = c->stage1_thread;
+        }
+        if (c->fill_thread > max_thread) {
+            max_thread = c->fill_thread;
+        }
+        trace_span(fp, "queue_pop", c->stage1_thread + 1,
+                   c->stage1_begin - c->stage1_wait, c->stage1_begin, i, NULL);
+        trace_span(fp, "stage1", c->stage1_thread + 1,
+                   c->stage1_begin, c->stage1_end, i, c);
+        trace_span(fp, "queue_pop", c->fill_thread + 1,
+                   c->fill_begin - c->fill_wait, c->fill_begin, i, NULL);
+        trace_span(fp, "fill_arrays", c->fill_thread + 1,
+                   c->fill_begin, c->fill_end, i, c);
+    }
+
+    for (i = 0; i <= max_thread; i++) {
+        fprintf(fp, ",\n{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, "
+                "\"tid\": %d, \"args\": {\"name\": \"reader %d\"}}", i + 1, i);
+    }
+
+    fprintf(fp, "\n]}\n");
+
+    return fclose(fp);
+}
+
+void
+free_csv_stats(FastCsvStats *stats)
+{
+    free(stats->chunks);
+    stats->chunks = NULL;
+    stats->nchunks = 0;
+}
+
+#ifndef DEBUG_NOTHREADS
+/* The threads are kept for the next parse_csv or write_csv. */
+static int
+start_threads(int nthreads)
+{
+    int i;
+#ifndef _WIN32
+    int rc;
+#endif
+
+    if (reader.nthreads < nthreads) {
+        if (reader.nthreads == 0) {
+            queue_init(&reader.inqueue);
+            queue_init(&reader.outqueue);
+            reader.threads = NULL;
+        }
+#ifdef _WIN32
+        reader.threads = (HANDLE *)realloc(reader.threads, nthreads * sizeof(HANDLE));
+#else
+        reader.threads = (pthread_t *)realloc(reader.threads, nthreads * sizeof(pthread_t));
+#endif
+        for (i = reader.nthreads; i < nthreads; i++) {
+            Worker *worker = (Worker *)malloc(sizeof(Worker));  /* lives as long as the thread */
+            worker->reader = &reader;
+            worker->thread_idx = i;
+#ifdef _WIN32
+            reader.threads[i] = (HANDLE)_beginthreadex(NULL, 0, parse_thread,
+                                                       (void *)worker, 0, NULL);
+#else
+            if ((rc = pthread_create(&reader.threads[i], NULL,
+                                     parse_thread, (void *)worker)) != 0) {
+                free(worker);
+                reader.nthreads = i;
+                return rc;
+            }
+#endif
         }
-        /* c is non-quoted char here */
-        while (c != sep && c != '\n') {
-            if (c != '\r') {
-                *q++ = c;
-                if (q >= cellbuf + cell_space) {
-                    cell_space *= 2;
-                    new_cellbuf = realloc(cellbuf, cell_space);
-                    q = new_cellbuf + (q - cellbuf);
-                    cellbuf = new_cellbuf;
-                }
+        reader.nthreads = nthreads;
+    }
+
+    return 0;
+}
+#endif
+
+static void
+init_common(ThreadCommon *common, const FastCsvInput *input, int ninputs, FastCsvResult *res)
+{
+    int i;
+
+    common->nchunks = 0;
+    common->all_chunks = NULL;
+    common->nbufs = ninputs;
+    common->inputs = input;
+    common->buf_chunks = (int *)malloc((ninputs + 1) * sizeof(int));
+    common->bigchunks = (Chunk **)calloc(ninputs, sizeof(Chunk *));
+    common->str_idxs = NULL;
+    common->n_str_cols = 0;
+    common->flags = input->flags;
+    common->sep = input->sep;
+    common->result = res;
+    common->missing_int_val = input->missing_int_val;
+    common->missing_float_val = input->missing_float_val;
+    common->stats = input->stats;
+    common->t0 = clock_now();
+    common->filter = input->filter;
+    common->filter_ncols = 0;
+
+    common->aggregate = input->aggregate;
+    common->agg_ncols = 0;
+    common->partition = input->partition;
+    common->agg_slot_types = NULL;
+    common->summary = (input->aggregate == NULL) ? input->summary : NULL;
+    common->n_na_tokens = input->n_na_tokens;
+    common->na_tokens = input->na_tokens;
+    common->narrow = input->narrow;
+    common->fill_col = -1;
+    common->memory_limit = input->memory_limit;
+    common->spill_dir = input->spill_dir;
+    common->nthreads = input->nthreads;
+    common->release_rows = 0;
+    common->fill_kernel = -1;
+    common->schema_ncols = input->schema_ncols;
+    common->schema = input->schema;
+    common->schema_widths = 0;
+    for (i = 0; input->schema != NULL && i < input->schema_ncols; i++) {
+        if (input->schema[i].type == COL_TYPE_STRING && input->schema[i].width == 0) {
+            common->schema_widths = 1;
+        }
+    }
+
+    if (input->summary != NULL) {
+        input->summary->ncols = 0;
+        input->summary->columns = NULL;
+    }
+
+    if (common->filter != NULL) {
+        filter_set_column(common->filter, NULL, 0, -1);
+    }
+    if (common->aggregate != NULL) {
+        aggregate_set_column(common->aggregate, NULL, 0, -1);
+    }
+    if (common->partition != NULL) {
+        partition_set_column(common->partition, NULL, 0, -1);
+    }
+}
+
+/* Length of the header line from p to data_begin, without the line end. */
+static size_t
+header_line_len(const uchar *p, const uchar *data_begin)
+{
+    const uchar *end = data_begin;
+
+    if (end > p && end[-1] == '\n') {
+        --end;
+    }
+    if (end > p && end[-1] == '\r') {
+        --end;
+    }
+    return end - p;
+}
+
+/* Parse the headers, and split the rest of the buffers into chunks, with
+   a job for each. */
+static int
+split_chunks(ThreadCommon *common, const FastCsvInput *inputs, int ninputs,
+             ThreadData **thread_datas_out)
+{
+    const FastCsvInput *input = &inputs[0];
+    int nthreads = input->nthreads;
+    const uchar **data_begins;
+    size_t total_len;
+    size_t header_len = 0;
+    int nchunks;
+    int i, j;
+    Chunk *chunks;
+    ThreadData *thread_datas;
+
+    /* Headers come from the first buffer only, but every buffer has the
+       same header line. */
+    data_begins = (const uchar **)malloc(ninputs * sizeof(const uchar *));
+    total_len = 0;
+    for (i = 0; i < ninputs; i++) {
+        const uchar *buf_end = inputs[i].csv_buf + inputs[i].buf_len;
+        if (input->nheaders) {
+            data_begins[i] = parse_headers(common, inputs[i].csv_buf, buf_end, i == 0);
+            if (data_begins[i] == NULL) {
+                free(data_begins);
+                return -1;
             }
-            ++p;
-            if (p >= buf_end) {
-                goto atstringend;
+            if (i == 0) {
+                header_len = header_line_len(inputs[0].csv_buf, data_begins[0]);
+            } else if (header_line_len(inputs[i].csv_buf, data_begins[i]) != header_len
+                       || memcmp(inputs[i].csv_buf, inputs[0].csv_buf, header_len) != 0) {
+                free(data_begins);
+                return FASTCSV_ERR_HEADERS;
             }
-            c = *p;
+        } else {
+            data_begins[i] = inputs[i].csv_buf;
         }
-    atstringend:
-        if (common->result->add_header(common->result, cellbuf, q - cellbuf)) {
-            return NULL;
+        total_len += buf_end - data_begins[i];
+    }
+
+    /* Share the chunks between the buffers in proportion to their size. */
+    nchunks = 0;
+    for (i = 0; i < ninputs; i++) {
+        size_t buf_len = inputs[i].csv_buf + inputs[i].buf_len - data_begins[i];
+        int buf_nchunks;
+        if (ninputs == 1) {
+            buf_nchunks = nthreads;
+        } else if (total_len == 0) {
+            buf_nchunks = 1;
+        } else {
+            buf_nchunks = (int)((buf_len * nthreads + total_len - 1) / total_len);
+            if (buf_nchunks < 1) {
+                buf_nchunks = 1;
+            }
         }
+        common->buf_chunks[i] = nchunks;
+        nchunks += buf_nchunks;
+    }
+    common->buf_chunks[ninputs] = nchunks;
 
-        if (p >= buf_end) {
-            break;
+    chunks = (Chunk *)malloc(nchunks * sizeof(Chunk));
+    common->nchunks = nchunks;
+    common->all_chunks = chunks;
+
+    if (common->stats != NULL) {
+        common->stats->nchunks = nchunks;
+        common->stats->chunks = (FastCsvChunkStats *)calloc(nchunks, sizeof(FastCsvChunkStats));
+    }
+
+    thread_datas = (ThreadData *)malloc(nchunks * sizeof(ThreadData));
+    for (i = 0; i < ninputs; i++) {
+        const uchar *data_begin = data_begins[i];
+        const uchar *buf_end = inputs[i].csv_buf + inputs[i].buf_len;
+        size_t buf_len = buf_end - data_begin;
+        int first = common->buf_chunks[i];
+        int buf_nchunks = common->buf_chunks[i + 1] - first;
+
+        for (j = 0; j < buf_nchunks; j++) {
+            Chunk *chunk = &chunks[first + j];
+            const uchar *chunk_buf = data_begin + buf_len * j / buf_nchunks;
+            const uchar *chunk_end = data_begin + buf_len * (j + 1) / buf_nchunks;
+            if (chunk_end > buf_end) {
+                chunk_end = buf_end;
+            }
+
+            chunk->chunk_idx = j;
+            chunk->buf = chunk_buf;
+            chunk->soft_end = chunk_end;
+            chunk->buf_end = buf_end;
+            chunk->keep = NULL;
+            chunk->parts = NULL;
+            chunk->part_out = NULL;
+            chunk->part_end = NULL;
+            chunk->agg_table = NULL;
+            chunk->col_accs = NULL;
+            chunk->null_bits = NULL;
+            array_buf_init(&chunk->columns);
+
+            thread_datas[first + j].chunk = chunk;
+            thread_datas[first + j].common = common;
+            thread_datas[first + j].write_chunk = NULL;
         }
-        ++p;
     }
 
-    free(cellbuf);
+    free(data_begins);
+    *thread_datas_out = thread_datas;
 
-    return p;
+    return 0;
 }
 
-int
-init_csv(FastCsvInput *input, const uchar *csv_buf, size_t buf_len,
-         int nheaders, int nthreads)
+/* Run the stage on every chunk, and wait for them all. */
+static void
+run_stage(ThreadCommon *common, ThreadData *thread_datas, int stage)
 {
-    input->csv_buf = csv_buf;
-    input->buf_len = buf_len;
-    input->nheaders = nheaders;
-    input->nthreads = nthreads;
-    input->sep = ',';
-    input->flags = 0;
-    input->missing_int_val = 0;
-    input->missing_float_val = NAN;
+    int i;
 
-    return 0;
+#ifdef DEBUG_NOTHREADS
+    for (i = 0; i < common->nchunks; i++) {
+        thread_datas[i].stage = stage;
+        run_job(&thread_datas[i]);
+    }
+#else
+    queue_reset(&reader.inqueue, common->nchunks);
+    queue_reset(&reader.outqueue, common->nchunks);
+    for (i = 0; i < common->nchunks; i++) {
+        thread_datas[i].stage = stage;
+        queue_push(&reader.inqueue, &thread_datas[i]);
+    }
+    for (i = 0; i < common->nchunks; i++) {
+        queue_pop(&reader.outqueue);
+    }
+#endif
+}
+
+static void
+free_chunks(ThreadCommon *common)
+{
+    int i;
+
+    for (i = 0; i < common->nchunks; i++) {
+        chunk_free(&common->all_chunks[i]);
+    }
+    for (i = 0; i < common->nbufs; i++) {
+        if (common->bigchunks[i] != NULL) {
+            chunk_free(common->bigchunks[i]);
+            free(common->bigchunks[i]);
+        }
+    }
+
+    free(common->all_chunks);
+    free(common->buf_chunks);
+    free(common->bigchunks);
+    free(common->str_idxs);
+    free(common->agg_slot_types);
 }
 
 int
-parse_csv(const FastCsvInput *input, FastCsvResult *res)
+parse_csv_multi(const FastCsvInput *inputs, int ninputs, FastCsvResult *res)
 {
-    size_t buf_len = input->buf_len;
-    int nthreads = input->nthreads;
-    const uchar *buf_end;
-    const uchar *data_begin;
+    const FastCsvInput *input = &inputs[0];
+    int nchunks;
     int i;
     int rc = 0;
-    Chunk *chunks;
-    ThreadData *thread_datas;
+    ThreadData *thread_datas = NULL;
     ThreadCommon common;
+    FastCsvStats trace_stats;
+    const char *trace_filename = input->trace_filename;
 
-    buf_end = input->csv_buf + buf_len;
-
-    chunks = (Chunk *)malloc(nthreads * sizeof(Chunk));
-    common.nchunks = nthreads;
-    common.all_chunks = chunks;
-    common.bigchunk = NULL;
-    common.str_idxs = NULL;
-    common.n_str_cols = 0;
-    common.flags = input->flags;
-    common.sep = input->sep;
-    common.result = res;
-    common.missing_int_val = input->missing_int_val;
-    common.missing_float_val = input->missing_float_val;
-
-    if (input->nheaders) {
-        data_begin = parse_headers(&common, input->csv_buf, buf_end);
-        if (data_begin == NULL) {
-            rc = -1;
-            goto done;
+    if (trace_filename == NULL) {
+        trace_filename = getenv("CAMOG_TRACE");
+    }
+
+    init_common(&common, input, ninputs, res);
+
+    if (common.stats == NULL && trace_filename != NULL && trace_filename[0] != '\0') {
+        common.stats = &trace_stats;
+    }
+
+    if (common.stats != NULL) {
+        memset(common.stats, 0, sizeof(FastCsvStats));
+    }
+
+    if ((rc = split_chunks(&common, inputs, ninputs, &thread_datas)) != 0) {
+        goto done;
+    }
+    nchunks = common.nchunks;
+
+#ifndef DEBUG_NOTHREADS
+    if ((rc = start_threads(input->nthreads)) != 0) {
+        goto cleanup;
+    }
+#endif
+
+    STATS_TIME(&common, stage1_begin);
+    run_stage(&common, thread_datas, 1);
+    STATS_TIME(&common, stage1_end);
+    STATS_TIME(&common, fixup_begin);
+    for (i = 0; i < ninputs; i++) {
+        fixup_parse(&common, i);
+    }
+    STATS_TIME(&common, fixup_end);
+    STATS_TIME(&common, allocate_begin);
+    resolve_columns(&common);
+    if (common.filter != NULL || common.partition != NULL) {
+        if (common.filter != NULL && (rc = check_filter(&common, common.filter)) != 0) {
+            goto cleanup;
+        }
+        if (common.partition != NULL && (rc = check_partition(&common)) != 0) {
+            goto cleanup;
+        }
+        STATS_TIME(&common, filter_begin);
+        run_stage(&common, thread_datas, 3);
+        STATS_TIME(&common, filter_end);
+        if (common.partition != NULL) {
+            partition_offsets(&common);
+        }
+    }
+    if (common.aggregate != NULL) {
+        if ((rc = check_aggregate(&common)) != 0) {
+            goto cleanup;
         }
-        buf_len = buf_end - data_begin;
     } else {
-        data_begin = input->csv_buf;
+        if ((rc = allocate_arrays(&common)) != 0) {
+            goto cleanup;
+        }
+        common.fill_kernel = select_fill_kernel(&common);
+    }
+    STATS_TIME(&common, allocate_end);
+    STATS_TIME(&common, fill_begin);
+    run_stage(&common, thread_datas, 2);
+    if (common.aggregate != NULL && (rc = add_aggregates(&common)) != 0) {
+        goto cleanup;
+    }
+    if (common.summary != NULL) {
+        summarize_columns(&common);
+    }
+    if (common.aggregate == NULL && common.partition == NULL && res->add_validity != NULL) {
+        rc = add_validity_bitmaps(&common);
+    }
+    STATS_TIME(&common, fill_end);
+
+    cleanup:
+
+    if (common.stats != NULL) {
+        for (i = 0; i < nchunks; i++) {
+            common.stats->queue_wait += (common.stats->chunks[i].stage1_wait
+                                         + common.stats->chunks[i].fill_wait);
+        }
     }
 
-    thread_datas = (ThreadData *)malloc(nthreads * sizeof(ThreadData));
-    for (i = 0; i < nthreads; i++) {
-        const uchar *chunk_buf = data_begin + buf_len * i / nthreads;
-        const uchar *chunk_end = data_begin + buf_len * (i + 1) / nthreads;
-        if (chunk_end > buf_end) {
-            chunk_end = buf_end;
+    if (trace_filename != NULL && trace_filename[0] != '\0') {
+        if (write_csv_trace(common.stats, trace_filename) != 0 && rc == 0) {
+            rc = FASTCSV_ERR_TRACE;
         }
+    }
+    if (common.stats == &trace_stats) {
+        free_csv_stats(&trace_stats);
+    }
+
+    done:
+
+    free(thread_datas);
+    free_chunks(&common);
+
+    return rc;
+}
 
-        chunks[i].chunk_idx = i;
-        chunks[i].buf = chunk_buf;
-        chunks[i].soft_end = chunk_end;
-        chunks[i].buf_end = buf_end;
-        array_buf_init(&chunks[i].columns);
+int
+parse_csv(const FastCsvInput *input, FastCsvResult *res)
+{
+    return parse_csv_multi(input, 1, res);
+}
 
-        thread_datas[i].chunk = &chunks[i];
-        thread_datas[i].common = &common;
+FastCsvTable *
+open_csv(const FastCsvInput *input, FastCsvResult *res)
+{
+    FastCsvTable *table = (FastCsvTable *)malloc(sizeof(FastCsvTable));
+    FastCsvInput table_input = *input;
+
+    /* every row, and only stage 1 is timed by the caller */
+    table_input.stats = NULL;
+    table_input.filter = NULL;
+    table_input.aggregate = NULL;
+    table_input.summary = NULL;
+    table_input.partition = NULL;
+
+    init_common(&table->common, &table_input, 1, res);
+    table->thread_datas = NULL;
+    table->nthreads = input->nthreads;
+    table->csv_buf = input->csv_buf;
+
+    if (split_chunks(&table->common, &table_input, 1, &table->thread_datas) != 0) {
+        close_csv(table);
+        return NULL;
     }
 
-#ifdef DEBUG_NOTHREADS
-    for (i = 0; i < nthreads; i++) {
-        parse_stage1(&common, &common.all_chunks[i]);
+#ifndef DEBUG_NOTHREADS
+    if (start_threads(table->nthreads) != 0) {
+        close_csv(table);
+        return NULL;
     }
-    fixup_parse(&common);
-    allocate_arrays(&common);
-    for (i = 0; i < nthreads; i++) {
-        fill_arrays(&common, &common.all_chunks[i]);
+#endif
+
+    run_stage(&table->common, table->thread_datas, 1);
+    fixup_parse(&table->common, 0);
+    resolve_columns(&table->common);
+
+    return table;
+}
+
+int
+csv_table_ncols(const FastCsvTable *table)
+{
+    return table->common.nchunks > 0 ? table->common.all_chunks[0].ncols : 0;
+}
+
+size_t
+csv_table_nrows(const FastCsvTable *table)
+{
+    size_t nrows = 0;
+    int i;
+
+    for (i = 0; i < table->common.nchunks; i++) {
+        nrows += table->common.all_chunks[i].nrows;
     }
 
-#else
+    return nrows;
+}
 
-    if (reader.nthreads < nthreads) {
-        if (reader.nthreads == 0) {
-            queue_init(&reader.inqueue);
-            queue_init(&reader.outqueue);
-            reader.threads = NULL;
-        }
-#ifdef _WIN32
-        reader.threads = (HANDLE *)realloc(reader.threads, nthreads * sizeof(HANDLE));
-        for (i = reader.nthreads; i < nthreads; i++) {
-            reader.threads[i] = (HANDLE)_beginthreadex(NULL, 0, parse_thread,
-                                                       (void *)&reader, 0, NULL);
-        }
-#else
-        reader.threads = (pthread_t *)realloc(reader.threads, nthreads * sizeof(pthread_t));
-        for (i = reader.nthreads; i < nthreads; i++) {
-            if ((rc = pthread_create(&reader.threads[i], NULL,
-                                     parse_thread, (void *)&reader)) != 0) {
-                return rc;
+void
+csv_table_column_info(const FastCsvTable *table, int col_idx, FastCsvColumnInfo *info)
+{
+    const ThreadCommon *common = &table->common;
+    const Column *column = &CHUNK_COLUMN(&common->all_chunks[0], col_idx);
+    int i;
+
+    info->type = column->out_type;
+    info->width = column->width;
+    info->nquoted = 0;
+    for (i = 0; i < common->nchunks; i++) {
+        info->nquoted += CHUNK_COLUMN(&common->all_chunks[i], col_idx).nquoted;
+    }
+}
+
+size_t
+csv_table_fixup_bytes(const FastCsvTable *table, int *nchunks_reparsed)
+{
+    const ThreadCommon *common = &table->common;
+    const Chunk *bigchunk = common->bigchunks[0];
+
+    if (bigchunk == NULL) {
+        *nchunks_reparsed = 0;
+        return 0;
+    }
+
+    *nchunks_reparsed = common->buf_chunks[1] - common->buf_chunks[0] - bigchunk->chunk_idx;
+    return bigchunk->found_end - bigchunk->buf;
+}
+
+size_t
+csv_table_row_offsets(const FastCsvTable *table, size_t step, size_t *offsets)
+{
+    const ThreadCommon *common = &table->common;
+    size_t row_idx = 0;
+    size_t n = 0;
+    int i, j;
+
+    for (i = 0; i < common->nchunks; i++) {
+        const Chunk *chunk = &common->all_chunks[i];
+        LinkedLink *offset_link = chunk->offset_buf.first;
+        uchar *offset_ptr = chunk->offset_buf.first_data;
+        size_t offset = chunk->buf - table->csv_buf;
+
+        for (j = 0; j < chunk->nrows; j++, row_idx++) {
+            if (row_idx % step == 0) {
+                offsets[n++] = offset;
             }
+            offset += *((width_t *)offset_ptr);
+            LINKED_NEXT(offset_link, offset_ptr, width_t);
         }
-#endif
-        reader.nthreads = nthreads;
     }
 
-    queue_reset(&reader.inqueue, nthreads * 2);
-    queue_reset(&reader.outqueue, nthreads * 2);
-    for (i = 0; i < nthreads; i++) {
-        thread_datas[i].stage = 1;
-        queue_push(&reader.inqueue, &thread_datas[i]);
+    return n;
+}
+
+int
+fill_csv_column(FastCsvTable *table, int col_idx, FastCsvResult *res)
+{
+    ThreadCommon *common = &table->common;
+    Chunk *chunks = common->all_chunks;
+    const Column *column;
+    size_t size;
+    uchar *xs;
+    int i;
+
+    if (col_idx < 0 || col_idx >= csv_table_ncols(table)) {
+        return -1;
     }
-    for (i = 0; i < nthreads; i++) {
-        queue_pop(&reader.outqueue);
+
+    column = &CHUNK_COLUMN(&chunks[0], col_idx);
+    size = (column->out_type == COL_TYPE_STRING) ? column->width : col_type_size(column->out_type);
+
+    common->result = res;
+    xs = (uchar *)call_add_column(common, column->out_type, csv_table_nrows(table),
+                                  (column->out_type == COL_TYPE_STRING) ? column->width : 0);
+    if (xs == NULL) {
+        return -1;
     }
-    fixup_parse(&common);
-    allocate_arrays(&common);
-    for (i = 0; i < nthreads; i++) {
-        thread_datas[i].stage = 2;
-        queue_push(&reader.inqueue, &thread_datas[i]);
+    for (i = 0; i < common->nchunks; i++) {
+        CHUNK_COLUMN(&chunks[i], col_idx).arr_ptr = xs;
+        xs += chunks[i].nrows * size;
     }
-    for (i = 0; i < nthreads; i++) {
-        queue_pop(&reader.outqueue);
+
+#ifndef DEBUG_NOTHREADS
+    if (start_threads(table->nthreads) != 0) {
+        return -1;
     }
+#endif
 
-#endif  /* DEBUG_NOTHREADS */
+    common->fill_col = col_idx;
+    run_stage(common, table->thread_datas, 5);
 
-    free(thread_datas);
-    for (i = 0; i < common.nchunks; i++) {
-        chunk_free(&chunks[i]);
+    return 0;
+}
+
+void
+close_csv(FastCsvTable *table)
+{
+    free(table->thread_datas);
+    free_chunks(&table->common);
+    free(table);
+}
+
+static int
+write_chunk(FILE *fp, const uchar *buf, size_t len)
+{
+    return (fwrite(buf, 1, len, fp) == len) ? 0 : -1;
+}
+
+int
+write_csv(const FastCsvOutput *output, const char *fname)
+{
+    FILE *fp;
+    WriteChunk *chunks;
+    ThreadData *thread_datas;
+    uchar *done;
+    size_t rows_per_chunk;
+    int nchunks, nwritten, i, col_idx;
+    int rc = 0;
+    int nthreads = output->nthreads > 0 ? output->nthreads : 1;
+
+    if ((fp = fopen(fname, "wb")) == NULL) {
+        return -1;
     }
-    if (common.bigchunk != NULL) {
-        chunk_free(common.bigchunk);
-        free(common.bigchunk);
+
+    if (output->headers != NULL) {
+        size_t width = 1;
+        uchar *line, *q;
+        for (col_idx = 0; col_idx < output->ncols; col_idx++) {
+            width += output->headers[col_idx].len * 2 + 3;
+        }
+        q = line = (uchar *)malloc(width);
+        for (col_idx = 0; col_idx < output->ncols; col_idx++) {
+            if (col_idx > 0) {
+                *q++ = output->sep;
+            }
+            q = format_string(q, output->headers[col_idx].str, output->headers[col_idx].len,
+                              output->sep);
+        }
+        *q++ = '\n';
+        rc = write_chunk(fp, line, q - line);
+        free(line);
     }
 
-    done:
+    /* more chunks than threads, so writing overlaps formatting */
+    nchunks = nthreads * 4;
+    if ((size_t)nchunks > output->nrows) {
+        nchunks = (int)output->nrows;
+    }
+    if (output->ncols == 0) {
+        nchunks = 0;
+    }
+    rows_per_chunk = (nchunks > 0) ? (output->nrows + nchunks - 1) / nchunks : 0;
+
+    chunks = (WriteChunk *)calloc(nchunks + 1, sizeof(WriteChunk));
+    thread_datas = (ThreadData *)calloc(nchunks + 1, sizeof(ThreadData));
+    done = (uchar *)calloc(nchunks + 1, 1);
+    for (i = 0; i < nchunks; i++) {
+        chunks[i].output = output;
+        chunks[i].begin_row = i * rows_per_chunk;
+        chunks[i].end_row = (i + 1) * rows_per_chunk;
+        if (chunks[i].end_row > output->nrows) {
+            chunks[i].end_row = output->nrows;
+        }
+        if (chunks[i].begin_row > chunks[i].end_row) {
+            chunks[i].begin_row = chunks[i].end_row;
+        }
+        thread_datas[i].stage = 4;
+        thread_datas[i].write_chunk = &chunks[i];
+    }
+
+#ifdef DEBUG_NOTHREADS
+    for (nwritten = 0; nwritten < nchunks; nwritten++) {
+        format_rows(&chunks[nwritten]);
+        if (rc == 0) {
+            rc = write_chunk(fp, chunks[nwritten].buf, chunks[nwritten].len);
+        }
+        free(chunks[nwritten].buf);
+    }
+#else
+    if (rc == 0 && nchunks > 0) {
+        if ((rc = start_threads(nthreads)) != 0) {
+            errno = rc;
+            rc = -1;
+        }
+    }
+    if (rc == 0 && nchunks > 0) {
+        queue_reset(&reader.inqueue, nchunks);
+        queue_reset(&reader.outqueue, nchunks);
+        for (i = 0; i < nchunks; i++) {
+            queue_push(&reader.inqueue, &thread_datas[i]);
+        }
+
+        /* write each chunk once the ones before it are written */
+        nwritten = 0;
+        for (i = 0; i < nchunks; i++) {
+            ThreadData *thread_data = (ThreadData *)queue_pop(&reader.outqueue);
+            done[thread_data - thread_datas] = 1;
+            while (nwritten < nchunks && done[nwritten]) {
+                if (rc == 0) {
+                    rc = write_chunk(fp, chunks[nwritten].buf, chunks[nwritten].len);
+                }
+                free(chunks[nwritten].buf);
+                nwritten++;
+            }
+        }
+    }
+#endif
 
+    free(done);
+    free(thread_datas);
     free(chunks);
-    free(common.str_idxs);
+
+    if (fclose(fp) != 0) {
+        rc = -1;
+    }
 
     return rc;
 }
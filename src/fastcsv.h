@@ -23,19 +23,184 @@ typedef unsigned __int64 uint64_t;
 typedef __int64 int64_t;
 typedef unsigned __int32 uint32_t;
 typedef __int32 int32_t;
+typedef __int16 int16_t;
+typedef __int8 int8_t;
 #endif
 
 #define COL_TYPE_INT32 1
 #define COL_TYPE_INT64 2
 #define COL_TYPE_DOUBLE 3
 #define COL_TYPE_STRING 4
+/* Output types only, the column is parsed as COL_TYPE_INT64 or
+   COL_TYPE_DOUBLE.  Chosen by narrowing, or by fix_column_type. */
+#define COL_TYPE_INT8 5
+#define COL_TYPE_INT16 6
+#define COL_TYPE_FLOAT32 7
+/* int64 holding the value times 10 ** scale, parsed as COL_TYPE_DOUBLE
+   but with no floating point.  Values are rounded half away from zero
+   to the scale, and ones that do not fit are missing. */
+#define COL_TYPE_DECIMAL 8
+
+#define DECIMAL_MAX_SCALE 18
+
+#define NARROW_OFF 0
+#define NARROW_INT_ONLY 1  /* int8, int16 or int32 for integer columns */
+#define NARROW_AUTO 2  /* also float32 for short decimals with no exponent */
 
 #define FLAG_EXCEL_QUOTES 1
+#define FLAG_READ_AHEAD 2  /* buffers are mapped files, read each as the one before starts */
+
+/* parse_csv return codes, besides 0 and -1 */
+#define FASTCSV_ERR_FILTER_COLUMN -2  /* unknown filter column */
+#define FASTCSV_ERR_FILTER_TYPE -3  /* filter compares numbers with strings */
+#define FASTCSV_ERR_AGG_COLUMN -4  /* unknown aggregate column */
+#define FASTCSV_ERR_AGG_TYPE -5  /* numeric aggregate of a string column */
+#define FASTCSV_ERR_PARTITION_COLUMN -6  /* unknown partition key column */
+#define FASTCSV_ERR_TRACE -7  /* the columns were added, but not the trace file */
+#define FASTCSV_ERR_HEADERS -8  /* a buffer's header line is not the first buffer's */
+
+#define FILTER_AND 1
+#define FILTER_OR 2
+#define FILTER_EQ 3
+#define FILTER_NE 4
+#define FILTER_LT 5
+#define FILTER_LE 6
+#define FILTER_GT 7
+#define FILTER_GE 8
+#define FILTER_IN 9
+
+#define AGG_COUNT 1
+#define AGG_SUM 2
+#define AGG_MIN 3
+#define AGG_MAX 4
+#define AGG_MEAN 5
 
 #define NUMPY_STRING_OBJECT 0
 
 typedef unsigned char uchar;
 
+/* Times are in seconds since parse_csv was called.  A "wait" is the time
+   the worker spent blocked in queue_pop before it was given the job. */
+typedef struct {
+    size_t nbytes;
+    size_t nrows;
+    int stage1_thread;
+    double stage1_wait;
+    double stage1_begin;
+    double stage1_end;
+    int fill_thread;
+    double fill_wait;
+    double fill_begin;
+    double fill_end;
+} FastCsvChunkStats;
+
+typedef struct {
+    double stage1_begin;
+    double stage1_end;
+    double fixup_begin;
+    double fixup_end;
+    double allocate_begin;
+    double allocate_end;
+    double add_column_time;  /* part of allocate */
+    double filter_begin;  /* part of allocate, zero if no filter or partition */
+    double filter_end;
+    double fill_begin;
+    double fill_end;
+    double queue_wait;  /* total over all jobs */
+    size_t fixup_bytes;  /* re-scanned because a chunk began in quotes */
+    int nchunks_reparsed;
+    int n_string_cols;  /* inferred as string, before fix_column_type */
+    int nchunks;
+    FastCsvChunkStats *chunks;
+} FastCsvStats;
+
+/* Collected while the columns are filled.  Nulls are cells that got the
+   missing value, or are empty in a string column.  The other fields are
+   over the count values that are neither null nor NaN. */
+typedef struct {
+    int type;
+    size_t count;
+    size_t nulls;
+    size_t nans;
+    int64_t int_min;  /* integer columns */
+    int64_t int_max;
+    int64_t int_sum;
+    double float_min;  /* float columns */
+    double float_max;
+    double float_sum;
+    double ndistinct;  /* HyperLogLog estimate */
+} FastCsvColumnStats;
+
+typedef struct {
+    int ncols;
+    FastCsvColumnStats *columns;
+} FastCsvSummary;
+
+typedef struct {
+    int type;  /* COL_TYPE_INT64, COL_TYPE_DOUBLE or COL_TYPE_STRING */
+    int64_t int_val;
+    double float_val;
+    const uchar *str;
+    size_t len;
+} FastCsvValue;
+
+/* A row filter, applied before the output is allocated.  Leaves compare
+   a column (as it appears in the output) with values; col_idx is looked
+   up from col_name in the headers if col_name is not NULL. */
+typedef struct fast_csv_filter_s {
+    int op;
+    int col_idx;
+    const uchar *col_name;
+    size_t col_name_len;
+    int nvalues;  /* 1, except for FILTER_IN */
+    FastCsvValue *values;
+    int nchildren;  /* FILTER_AND and FILTER_OR */
+    struct fast_csv_filter_s *children;
+} FastCsvFilter;
+
+/* A group key or aggregate column.  col_idx is looked up from col_name
+   in the headers if col_name is not NULL.  AGG_COUNT counts rows if
+   col_idx is -1 and col_name is NULL. */
+typedef struct {
+    int op;  /* not used by group keys */
+    int col_idx;
+    const uchar *col_name;
+    size_t col_name_len;
+} FastCsvAggColumn;
+
+/* Instead of the csv columns, add the group keys then the aggregates, one
+   row per group in order of first appearance.  Null cells, empty or NA,
+   are skipped by every aggregate, and NaNs by AGG_MIN and AGG_MAX.  A
+   group with no values gets NaN, or missing_int_val for an integer
+   AGG_MIN or AGG_MAX. */
+typedef struct {
+    int nkeys;
+    FastCsvAggColumn *keys;
+    int naggs;
+    FastCsvAggColumn *aggs;
+} FastCsvAggregate;
+
+/* Rows go to partition hash(key) % nparts, where the key is the cell of
+   column col_idx as loaded, so equal keys in other files go to the same
+   partition.  Each output column has the rows of partition 0, then of
+   partition 1 and so on, each in file order, and nrows (nparts entries,
+   at most 65536) is filled in with how many rows each has.  col_idx is
+   looked up from col_name in the headers if col_name is not NULL. */
+typedef struct {
+    int col_idx;
+    const uchar *col_name;
+    size_t col_name_len;
+    int nparts;
+    size_t *nrows;
+} FastCsvPartition;
+
+/* A column of FastCsvInput.schema.  width is the most bytes kept of a
+   COL_TYPE_STRING cell, or 0 for the widest cell in the csv. */
+typedef struct {
+    int type;
+    size_t width;
+} FastCsvSchemaColumn;
+
 typedef struct {
     const uchar *csv_buf;
     size_t buf_len;
@@ -45,16 +210,130 @@ typedef struct {
     int nheaders;
     int64_t missing_int_val;
     double missing_float_val;
+    FastCsvStats *stats;  /* filled in if not NULL */
+    const char *trace_filename;  /* else $CAMOG_TRACE, if set */
+    FastCsvFilter *filter;  /* rows to keep, or NULL for all */
+    FastCsvAggregate *aggregate;  /* NULL to add the csv columns */
+    FastCsvSummary *summary;  /* filled in if not NULL, free with free_csv_summary */
+    int n_na_tokens;
+    const FastCsvValue *na_tokens;  /* strings read as missing, COL_TYPE_STRING */
+    int narrow;  /* NARROW_OFF, NARROW_INT_ONLY or NARROW_AUTO */
+    /* If not 0, and the columns with the parse buffers would take more
+       bytes than this, the columns are mapped from files in spill_dir
+       (else $TMPDIR) and given to add_mapped_column. */
+    size_t memory_limit;
+    const char *spill_dir;
+    /* If not NULL, the output columns, so the types are not inferred, and
+       stage 1 only finds the row ends unless a string column has width 0.
+       Cells past schema_ncols are skipped.  fix_column_type is still
+       called, with the schema type. */
+    int schema_ncols;
+    const FastCsvSchemaColumn *schema;
+    /* If not NULL, the kept rows are grouped by partition, and
+       add_validity and memory_limit are not used. */
+    FastCsvPartition *partition;
 } FastCsvInput;
 
 typedef struct fast_csv_result_s {
     int (*add_header)(struct fast_csv_result_s *, const uchar *, size_t);
+    /* Room for nrows of the type (and width, for COL_TYPE_STRING), which
+       may be a buffer kept from an earlier parse.  Returns NULL to stop,
+       and parse_csv returns -1. */
     void *(*add_column)(struct fast_csv_result_s *, int, size_t, size_t);
     int (*fix_column_type)(struct fast_csv_result_s *, int, int);
+    /* If not NULL, called after the columns are filled for each column
+       with nulls, to get (nrows + 7) / 8 bytes for an Arrow style
+       validity bitmap: bit i & 7 of byte i >> 3 is set if row i is valid.
+       Nulls are cells that got the missing value, empty cells and NA
+       tokens. */
+    uchar *(*add_validity)(struct fast_csv_result_s *, int, size_t);
+    /* If not NULL, called for each COL_TYPE_DECIMAL column with the most
+       digits seen after a decimal point, to get the scale.  Otherwise the
+       scale is that number of digits. */
+    int (*fix_decimal_scale)(struct fast_csv_result_s *, int, int);
+    /* Like add_column, for size bytes mapped from an unlinked file, which
+       the result unmaps when done with it.  Returns non-zero if it cannot
+       take the mapping, and the column goes to add_column instead. */
+    int (*add_mapped_column)(struct fast_csv_result_s *, int, size_t, size_t, void *, size_t);
 } FastCsvResult;
 
+/* A column to write, laid out as from add_column.  validity is an Arrow
+   style bitmap as from add_validity, or NULL if every row is valid, and
+   invalid rows are written as empty cells. */
+typedef struct {
+    int type;  /* not COL_TYPE_DECIMAL */
+    const void *data;
+    size_t width;  /* COL_TYPE_STRING, padded with NULs */
+    const uchar *validity;
+} FastCsvColumn;
+
+typedef struct {
+    uchar sep;
+    int nthreads;
+    const FastCsvValue *headers;  /* ncols strings, or NULL for no header line */
+    int ncols;
+    size_t nrows;
+    const FastCsvColumn *columns;
+} FastCsvOutput;
+
 int init_csv(FastCsvInput *, const uchar *, size_t, int, int);
 
 int parse_csv(const FastCsvInput *, FastCsvResult *);
 
+void free_csv_stats(FastCsvStats *);
+
+void free_csv_summary(FastCsvSummary *);
+
+/* Chrome trace event JSON, viewable in chrome://tracing or Perfetto. */
+int write_csv_trace(const FastCsvStats *, const char *);
+
+/* Parse several buffers into one set of columns, rows in buffer order.
+   Options are taken from the first input, and headers from the first
+   buffer (the header lines of the others are skipped). */
+int parse_csv_multi(const FastCsvInput *, int, FastCsvResult *);
+
+/* A csv after stage 1 only: the column types and widths, and the offset
+   of every row, so each column can be filled on its own later.  The
+   buffer must outlive it. */
+typedef struct fast_csv_table_s FastCsvTable;
+
+/* Headers and fix_column_type go to the result as in parse_csv, but
+   stats, filter, aggregate and summary are not used.  Returns NULL if
+   add_header fails. */
+FastCsvTable *open_csv(const FastCsvInput *, FastCsvResult *);
+
+int csv_table_ncols(const FastCsvTable *);
+
+size_t csv_table_nrows(const FastCsvTable *);
+
+/* What stage 1 found in a column: the type it is filled as, the widest
+   cell (at least 1), and how many cells open with a quote. */
+typedef struct {
+    int type;
+    size_t width;
+    size_t nquoted;
+} FastCsvColumnInfo;
+
+void csv_table_column_info(const FastCsvTable *, int, FastCsvColumnInfo *);
+
+/* Bytes parsed again because a chunk began inside quotes, as in
+   FastCsvStats. */
+size_t csv_table_fixup_bytes(const FastCsvTable *, int *);
+
+/* The byte offsets in the buffer of rows 0, step, 2 * step and so on,
+   which are never inside quotes.  Returns how many, (nrows + step - 1) /
+   step, which offsets must have room for. */
+size_t csv_table_row_offsets(const FastCsvTable *, size_t, size_t *);
+
+/* Call add_column for the column, and fill it on the parse threads.
+   add_validity is not used. */
+int fill_csv_column(FastCsvTable *, int, FastCsvResult *);
+
+void close_csv(FastCsvTable *);
+
+/* Format ranges of rows on the parse threads, and write them in order.
+   Cells are quoted only if they need it.  Returns 0, or -1 with errno
+   set. */
+int write_csv(const FastCsvOutput *, const char *);
+
 #endif  /* _FASTCSV_H */
@@ -83,4 +83,21 @@
 
 #endif
 
+static const double fpowers10[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10};
+
+/* Correctly rounded if m < 2^24 and |e| <= 10, because then m and 10^|e|
+   are exact floats, and rounding their double product or quotient to
+   float is the same as rounding once.  Otherwise rounds twice. */
+#define FASTCSV_TOFLOAT(s, m, e, v)                                     \
+    do {                                                                \
+        if ((m) < (1 << 24) && (e) >= -10 && (e) <= 10) {               \
+            v = (float)(((e) >= 0) ? (double)(s * m) * fpowers10[e]     \
+                        : (double)(s * m) / fpowers10[-(e)]);           \
+        } else {                                                        \
+            double d_;                                                  \
+            FASTCSV_TODOUBLE(s, m, e, d_);                              \
+            v = (float)d_;                                              \
+        }                                                               \
+    } while (0)
+
 #endif
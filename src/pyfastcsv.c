@@ -28,38 +28,241 @@
 
 #include "fastcsv.h"
 
+#if NPY_ABI_VERSION < 0x02000000  /* numpy 1.x */
+#define PyDataType_ELSIZE(descr) ((descr)->elsize)
+#endif
+
 typedef struct {
     FastCsvResult r;
     PyObject *col_to_type;
     PyObject *headers;
     PyObject *columns;
+    PyObject *validity;  /* bitmap or None for each column */
+    PyObject *decimals;  /* column to scale, or None to infer it */
+    PyObject *scales;  /* scale or None for each column */
+    /* With blocks, numeric columns of the same type are the rows of one
+       2-d array, as pandas keeps them. */
+    int blocks;
+    PyObject *col_types;  /* from fix_column_type */
+    PyObject *block_arrs[COL_TYPE_DECIMAL + 1];
+    Py_ssize_t block_next[COL_TYPE_DECIMAL + 1];
+    PyObject *out;  /* arrays to fill instead of new ones, or NULL */
 } PyFastCsvResult;
 
+static int
+npy_type(int col_type)
+{
+    switch (col_type) {
+    case COL_TYPE_INT8:
+        return NPY_INT8;
+    case COL_TYPE_INT16:
+        return NPY_INT16;
+    case COL_TYPE_INT32:
+        return NPY_INT32;
+    case COL_TYPE_INT64:
+    case COL_TYPE_DECIMAL:
+        return NPY_INT64;
+    case COL_TYPE_FLOAT32:
+        return NPY_FLOAT32;
+    case COL_TYPE_DOUBLE:
+        return NPY_FLOAT64;
+    default:
+        return NPY_STRING;
+    }
+}
+
+/* The first nrows of the next array of out, if it fits the column,
+   else NULL with an exception set. */
+static PyObject *
+out_column(PyFastCsvResult *pyres, int col_type, size_t nrows, size_t width)
+{
+    Py_ssize_t i, col_idx = PyList_GET_SIZE(pyres->columns);
+    PyArrayObject *arr;
+    size_t nbytes;
+
+    if (col_idx >= PyList_GET_SIZE(pyres->out)) {
+        PyErr_Format(PyExc_ValueError, "out has %zd arrays, but the csv has more columns",
+                     PyList_GET_SIZE(pyres->out));
+        return NULL;
+    }
+
+    arr = (PyArrayObject *)PyList_GET_ITEM(pyres->out, col_idx);
+    if (!PyArray_Check((PyObject *)arr) || PyArray_NDIM(arr) != 1
+        || !PyArray_IS_C_CONTIGUOUS(arr) || !PyArray_ISWRITEABLE(arr)) {
+        PyErr_Format(PyExc_ValueError, "out[%zd] is not a writeable contiguous array", col_idx);
+        return NULL;
+    }
+    if (PyArray_TYPE(arr) != npy_type(col_type) || !PyArray_ISNOTSWAPPED(arr)
+        || (col_type == COL_TYPE_STRING && (size_t)PyArray_ITEMSIZE(arr) != width)) {
+        if (col_type == COL_TYPE_STRING) {
+            PyErr_Format(PyExc_ValueError, "out[%zd] must be S%zu", col_idx, width);
+        } else {
+            PyErr_Format(PyExc_ValueError, "out[%zd] has the wrong dtype for the column",
+                         col_idx);
+        }
+        return NULL;
+    }
+    if ((size_t)PyArray_DIM(arr, 0) < nrows) {
+        PyErr_Format(PyExc_ValueError, "out[%zd] has %zd rows, but the csv has %zu", col_idx,
+                     (Py_ssize_t)PyArray_DIM(arr, 0), nrows);
+        return NULL;
+    }
+    nbytes = nrows * PyArray_ITEMSIZE(arr);
+
+    for (i = 0; i < col_idx; i++) {
+        PyArrayObject *prev = (PyArrayObject *)PyList_GET_ITEM(pyres->out, i);
+        char *start = PyArray_BYTES(prev);
+        char *end = start + nrows * PyArray_ITEMSIZE(prev);
+        if (PyArray_BYTES(arr) < end && start < PyArray_BYTES(arr) + nbytes) {
+            PyErr_Format(PyExc_ValueError, "out[%zd] overlaps out[%zd]", col_idx, i);
+            return NULL;
+        }
+    }
+
+    return PySequence_GetSlice((PyObject *)arr, 0, (Py_ssize_t)nrows);
+}
+
+/* The next row of the block for col_type, or NULL to use a 1-d array. */
+static PyObject *
+block_row(PyFastCsvResult *pyres, int col_type, size_t nrows)
+{
+    PyObject *block = pyres->block_arrs[col_type];
+
+    if (block == NULL) {
+        npy_intp dims[2];
+        Py_ssize_t i, n = 0;
+        for (i = 0; i < PyList_GET_SIZE(pyres->col_types); i++) {
+            PyObject *type_obj = PyList_GET_ITEM(pyres->col_types, i);
+            n += (PyLong_Check(type_obj) && PyLong_AsLong(type_obj) == col_type);
+        }
+        if (n == 0) {
+            return NULL;
+        }
+        dims[0] = n;
+        dims[1] = nrows;
+        if ((block = PyArray_SimpleNew(2, dims, npy_type(col_type))) == NULL) {
+            PyErr_Clear();
+            return NULL;
+        }
+        pyres->block_arrs[col_type] = block;
+        pyres->block_next[col_type] = 0;
+    }
+
+    if (pyres->block_next[col_type] >= PyArray_DIM((PyArrayObject *)block, 0)) {
+        return NULL;
+    }
+
+    return PySequence_GetItem(block, pyres->block_next[col_type]++);  /* a view */
+}
+
 static void *
 py_add_column(FastCsvResult *res, int col_type, size_t nrows, size_t width)
 {
-    PyObject *arr;
+    PyObject *arr = NULL;
     npy_intp dims[1];
     PyFastCsvResult *pyres = (PyFastCsvResult *)res;
 
     dims[0] = nrows;
 
-    switch (col_type) {
-    case COL_TYPE_INT64:
-        arr = PyArray_SimpleNew(1, dims, NPY_INT64);
-        break;
-    case COL_TYPE_DOUBLE:
-        arr = PyArray_SimpleNew(1, dims, NPY_FLOAT64);
-        break;
-    default:
-        arr = PyArray_New(&PyArray_Type, 1, dims, NPY_STRING, NULL, NULL, width, 0, NULL);
-        break;
+    if (pyres->out != NULL) {
+        if ((arr = out_column(pyres, col_type, nrows, width)) == NULL) {
+            return NULL;
+        }
+    } else if (pyres->blocks && col_type != COL_TYPE_STRING) {
+        arr = block_row(pyres, col_type, nrows);
+    }
+    if (arr == NULL) {
+        if (col_type == COL_TYPE_STRING) {
+            arr = PyArray_New(&PyArray_Type, 1, dims, NPY_STRING, NULL, NULL, width, 0, NULL);
+        } else {
+            arr = PyArray_SimpleNew(1, dims, npy_type(col_type));
+        }
     }
     PyList_Append(pyres->columns, arr);  /* increfs */
     Py_DECREF(arr);
     return PyArray_DATA((PyArrayObject *)arr);
 }
 
+#ifndef _WIN32
+typedef struct {
+    void *data;
+    size_t size;
+} SpillMapping;
+
+#define SPILL_CAPSULE "camog._cfastcsv.spill"
+
+static void
+free_spill(PyObject *capsule)
+{
+    SpillMapping *mapping = (SpillMapping *)PyCapsule_GetPointer(capsule, SPILL_CAPSULE);
+
+    munmap(mapping->data, mapping->size);
+    free(mapping);
+}
+
+/* The array owns the mapping through a capsule as its base. */
+static int
+py_add_mapped_column(FastCsvResult *res, int col_type, size_t nrows, size_t width,
+                     void *data, size_t size)
+{
+    PyObject *arr, *capsule;
+    npy_intp dims[1];
+    SpillMapping *mapping;
+    PyFastCsvResult *pyres = (PyFastCsvResult *)res;
+
+    dims[0] = nrows;
+
+    if ((arr = PyArray_New(&PyArray_Type, 1, dims, npy_type(col_type), NULL, data,
+                           (col_type == COL_TYPE_STRING) ? width : 0,
+                           NPY_ARRAY_CARRAY, NULL)) == NULL) {
+        PyErr_Clear();
+        return -1;
+    }
+    mapping = (SpillMapping *)malloc(sizeof(SpillMapping));
+    mapping->data = data;
+    mapping->size = size;
+    if ((capsule = PyCapsule_New(mapping, SPILL_CAPSULE, &free_spill)) == NULL) {
+        PyErr_Clear();
+        free(mapping);
+        Py_DECREF(arr);
+        return -1;
+    }
+    Py_INCREF(capsule);
+    if (PyArray_SetBaseObject((PyArrayObject *)arr, capsule) != 0) {  /* steals */
+        PyErr_Clear();
+        mapping->size = 0;  /* munmap does nothing, the caller unmaps it */
+        Py_DECREF(capsule);
+        Py_DECREF(arr);
+        return -1;
+    }
+    Py_DECREF(capsule);
+    PyList_Append(pyres->columns, arr);
+    Py_DECREF(arr);
+    return 0;
+}
+#endif
+
+static uchar *
+py_add_validity(FastCsvResult *res, int col_idx, size_t nrows)
+{
+    PyObject *arr;
+    npy_intp dims[1];
+    PyFastCsvResult *pyres = (PyFastCsvResult *)res;
+
+    dims[0] = (nrows + 7) / 8;
+
+    /* called once the columns are all added */
+    while (PyList_GET_SIZE(pyres->validity) < PyList_GET_SIZE(pyres->columns)) {
+        PyList_Append(pyres->validity, Py_None);
+    }
+
+    if ((arr = PyArray_SimpleNew(1, dims, NPY_UINT8)) == NULL) {
+        return NULL;
+    }
+    PyList_SetItem(pyres->validity, col_idx, arr);  /* steals */
+    return (uchar *)PyArray_DATA((PyArrayObject *)arr);
+}
+
 static int
 py_add_header(FastCsvResult *res, const uchar *str, size_t len)
 {
@@ -85,38 +288,47 @@ py_add_header(FastCsvResult *res, const uchar *str, size_t len)
     return 0;
 }
 
-static int
-py_fix_column_type(FastCsvResult *res, int col_idx, int col_type)
+/* The value for the column in dict, keyed by header or index, or NULL.
+   Borrowed. */
+static PyObject *
+column_lookup(PyFastCsvResult *pyres, PyObject *dict, int col_idx)
 {
-    PyFastCsvResult *pyres = (PyFastCsvResult *)res;
-    PyObject *pytype = NULL;
+    PyObject *value = NULL;
     PyObject *col_name;
 
-    if (pyres->col_to_type == NULL || pyres->col_to_type == Py_None) {
-        return col_type;
+    if (dict == NULL || dict == Py_None) {
+        return NULL;
     }
 
     col_name = PySequence_GetItem(pyres->headers, col_idx);
     if (col_name == NULL) {
         PyErr_Clear();
     } else {
-        pytype = PyDict_GetItem(pyres->col_to_type, col_name);  /* borrowed */
+        value = PyDict_GetItem(dict, col_name);  /* borrowed */
         Py_DECREF(col_name);
     }
 
-    if (pytype == NULL) {
+    if (value == NULL) {
 #if PY_MAJOR_VERSION >= 3
         col_name = PyLong_FromLong(col_idx);
 #else
         col_name = PyInt_FromLong(col_idx);
 #endif
-        pytype = PyDict_GetItem(pyres->col_to_type, col_name);  /* borrowed */
+        value = PyDict_GetItem(dict, col_name);  /* borrowed */
         Py_DECREF(col_name);
     }
 
-    if (pytype == NULL) {
-        return col_type;
-    }
+    return value;
+}
+
+/* The COL_TYPE_ for str, int, float or a numpy type, else -1.  width is
+   the size of a numpy string type, or 0. */
+static int
+column_type_from_py(PyObject *pytype, size_t *width)
+{
+    PyArray_Descr *descr = NULL;
+
+    *width = 0;
 
     if (pytype == (PyObject *)
 #if PY_MAJOR_VERSION >= 3
@@ -140,156 +352,1450 @@ py_fix_column_type(FastCsvResult *res, int col_idx, int col_type)
         return COL_TYPE_DOUBLE;
     }
 
-    return col_type;
+    /* numpy types, eg. np.int16 or 'f4' */
+    if (PyArray_DescrConverter2(pytype, &descr) == NPY_SUCCEED && descr != NULL) {
+        int type_num = descr->type_num;
+        if (type_num == NPY_STRING) {
+            *width = PyDataType_ELSIZE(descr);
+        }
+        Py_DECREF(descr);
+        switch (type_num) {
+        case NPY_INT8:
+            return COL_TYPE_INT8;
+        case NPY_INT16:
+            return COL_TYPE_INT16;
+        case NPY_INT32:
+            return COL_TYPE_INT32;
+        case NPY_INT64:
+            return COL_TYPE_INT64;
+        case NPY_FLOAT32:
+            return COL_TYPE_FLOAT32;
+        case NPY_FLOAT64:
+            return COL_TYPE_DOUBLE;
+        case NPY_STRING:
+            return COL_TYPE_STRING;
+        }
+    }
+    PyErr_Clear();
+
+    return -1;
 }
 
-static PyObject *
-py_parse_csv(const uchar *csv_buf, size_t buf_len, PyObject *sep_obj, int nthreads,
-             int flags, int nheaders, int64_t missing_int_val, double missing_float_val,
-             PyObject *col_to_type)
+static int
+py_column_type(FastCsvResult *res, int col_idx, int col_type)
 {
-    uchar sep;
-    FastCsvInput input;
-    PyFastCsvResult result;
-    PyObject *res_obj;
+    PyFastCsvResult *pyres = (PyFastCsvResult *)res;
+    PyObject *pytype;
+    size_t width;
+    int type;
 
-    if (sep_obj == NULL) {
-        sep = ',';
-    } else {
-#if PY_MAJOR_VERSION >= 3
-        sep = PyUnicode_AsUTF8(sep_obj)[0];  /* callee frees later */
-#else
-        sep = PyString_AsString(sep_obj)[0];
-#endif
+    if (column_lookup(pyres, pyres->decimals, col_idx) != NULL) {
+        return COL_TYPE_DECIMAL;
     }
 
-    init_csv(&input, csv_buf, buf_len, nheaders, nthreads);
-    input.sep = sep;
-    input.flags = flags;
-    input.missing_int_val = missing_int_val;
-    input.missing_float_val = missing_float_val;
-
-    result.r.add_header = &py_add_header;
-    result.r.add_column = &py_add_column;
-    result.r.fix_column_type = &py_fix_column_type;
-    if (nheaders == 0) {
-        Py_INCREF(Py_None);
-        result.headers = Py_None;
-    } else {
-        result.headers = PyList_New(0);
+    if ((pytype = column_lookup(pyres, pyres->col_to_type, col_idx)) == NULL) {
+        return col_type;
     }
-    result.columns = PyList_New(0);
-    result.col_to_type = col_to_type;
 
-    if (parse_csv(&input, (FastCsvResult *)&result) != 0) {
-        return NULL;
-    }
+    type = column_type_from_py(pytype, &width);
 
-    res_obj = PyTuple_New(2);
-    PyTuple_SET_ITEM(res_obj, 0, result.headers);
-    PyTuple_SET_ITEM(res_obj, 1, result.columns);
+    return (type < 0) ? col_type : type;
+}
 
-    return res_obj;
+static int
+py_fix_column_type(FastCsvResult *res, int col_idx, int col_type)
+{
+    PyFastCsvResult *pyres = (PyFastCsvResult *)res;
+    PyObject *type_obj;
+
+    col_type = py_column_type(res, col_idx, col_type);
+
+    if (pyres->blocks) {
+        while (PyList_GET_SIZE(pyres->col_types) <= col_idx) {
+            PyList_Append(pyres->col_types, Py_None);
+        }
+        type_obj = PyLong_FromLong(col_type);
+        PyList_SetItem(pyres->col_types, col_idx, type_obj);  /* steals */
+    }
+
+    return col_type;
 }
 
-static PyObject *
-parse_csv_func(PyObject *self, PyObject *args)
+static int
+py_fix_decimal_scale(FastCsvResult *res, int col_idx, int frac_digits)
 {
-    PyObject *str_obj, *sep_obj = NULL, *col_to_type = NULL;
-    const uchar *csv_buf;
-    Py_ssize_t buf_len;
-    int nthreads = 4;
-    int flags = 0;
-    int nheaders = 0;
-    int missing_int_val = 0;
-    double missing_float_val = 0.0;
+    PyFastCsvResult *pyres = (PyFastCsvResult *)res;
+    PyObject *scale_obj = column_lookup(pyres, pyres->decimals, col_idx);
+    int scale = frac_digits;
 
-    if (!PyArg_ParseTuple(args, "O|OiiiidO", &str_obj, &sep_obj, &nthreads,
-                          &flags, &nheaders, &missing_int_val, &missing_float_val,
-                          &col_to_type)) {
-        return NULL;
+    if (scale_obj != NULL && scale_obj != Py_None) {
+        scale = (int)PyLong_AsLong(scale_obj);  /* checked by camog */
+    }
+    if (scale > DECIMAL_MAX_SCALE) {
+        scale = DECIMAL_MAX_SCALE;
     }
 
-#if PY_MAJOR_VERSION >= 3
-    if (PyBytes_Check(str_obj)) {
-        PyBytes_AsStringAndSize(str_obj, (char **)&csv_buf, &buf_len);
-    } else {
-        csv_buf = (uchar *)PyUnicode_AsUTF8AndSize(str_obj, &buf_len);
+    while (PyList_GET_SIZE(pyres->scales) <= col_idx) {
+        PyList_Append(pyres->scales, Py_None);
     }
-#else
-    PyString_AsStringAndSize(str_obj, (char **)&csv_buf, &buf_len);
-#endif
+    PyList_SetItem(pyres->scales, col_idx, PyLong_FromLong(scale));  /* steals */
 
-    return py_parse_csv(csv_buf, buf_len, sep_obj, nthreads, flags, nheaders,
-                        missing_int_val, missing_float_val, col_to_type);
+    return scale;
 }
 
-static PyObject *
-parse_file_func(PyObject *self, PyObject *args)
-{
-    PyObject *fname_obj;
-    PyObject *sep_obj = NULL, *col_to_type = NULL;
-    PyObject *res;
+typedef struct {
+    void *data;
+    size_t size;
 #ifdef _WIN32
     HANDLE map_handle;
 #endif
-    void *filedata;
-    const char *fname;
-    int nthreads = 4;
-    int flags = 0;
-    int nheaders = 0;
-    int missing_int_val = 0;
-    double missing_float_val = 0.0;
-    int fd;
-    struct stat stat_buf;
+} MappedFile;
 
-    if (!PyArg_ParseTuple(args, "O|OiiiidO", &fname_obj, &sep_obj, &nthreads,
-                          &flags, &nheaders, &missing_int_val, &missing_float_val,
-                          &col_to_type)) {
-        return NULL;
-    }
+static int
+map_file(const char *fname, MappedFile *mapped)
+{
+    struct stat stat_buf;
+    int fd;
 
-#if PY_MAJOR_VERSION >= 3
-    fname = PyUnicode_AsUTF8(fname_obj);
-#else
-    fname = PyString_AsString(fname_obj);
-#endif
     if ((fd = open(fname, O_RDONLY)) < 0) {
-        return PyErr_Format(PyExc_IOError, "%s: could not open", fname);
+        PyErr_Format(PyExc_IOError, "%s: could not open", fname);
+        return -1;
     }
 
     fstat(fd, &stat_buf);
+    mapped->size = stat_buf.st_size;
 
 #ifdef _WIN32
-    map_handle = CreateFileMapping((HANDLE)_get_osfhandle(fd), 0, PAGE_READONLY, 0, 0, 0);
-    filedata = MapViewOfFile(map_handle, FILE_MAP_READ, 0, 0, stat_buf.st_size);
+    mapped->map_handle = CreateFileMapping((HANDLE)_get_osfhandle(fd), 0, PAGE_READONLY, 0, 0, 0);
+    mapped->data = MapViewOfFile(mapped->map_handle, FILE_MAP_READ, 0, 0, stat_buf.st_size);
 #else
-    if ((filedata = mmap(NULL, stat_buf.st_size, PROT_READ, MAP_PRIVATE, fd, 0)) == MAP_FAILED) {
+    if ((mapped->data = mmap(NULL, stat_buf.st_size, PROT_READ, MAP_PRIVATE, fd, 0)) == MAP_FAILED) {
         close(fd);
-        return PyErr_Format(PyExc_IOError, "%s: mmap failed", fname);
+        PyErr_Format(PyExc_IOError, "%s: mmap failed", fname);
+        return -1;
     }
 #endif
 
-    res = py_parse_csv(filedata, stat_buf.st_size, sep_obj, nthreads, flags, nheaders,
-                       missing_int_val, missing_float_val, col_to_type);
+    /* the mapping keeps the file, so many files can be mapped at once */
+    close(fd);
+
+    return 0;
+}
 
+static void
+unmap_file(MappedFile *mapped)
+{
 #ifdef _WIN32
-    UnmapViewOfFile(filedata);
-    CloseHandle(map_handle);
+    UnmapViewOfFile(mapped->data);
+    CloseHandle(mapped->map_handle);
 #else
-    munmap(filedata, stat_buf.st_size);
+    munmap(mapped->data, mapped->size);
 #endif
+}
 
-    close(fd);
+typedef struct {
+    PyObject *sep_obj;
+    int nthreads;
+    int flags;
+    int nheaders;
+    int missing_int_val;
+    double missing_float_val;
+    PyObject *col_to_type;
+    int return_stats;
+    const char *trace;
+    PyObject *filter;
+    PyObject *group_by;
+    PyObject *aggs;
+    int return_summary;
+    PyObject *na_values;
+    int return_validity;
+    int narrow;
+    PyObject *decimals;
+    int blocks;
+    PyObject *ranges;
+    Py_ssize_t memory_limit;
+    const char *spill_dir;
+    PyObject *schema;
+    PyObject *partition_by;
+    int npartitions;
+    PyObject *out;
+} PyFastCsvOptions;
+
+/* The first argument (the csv data, filename or filenames) is named by the caller. */
+static int
+parse_options(PyObject *args, PyObject *kwds, char *first_name, PyObject **first_obj,
+              PyFastCsvOptions *opts)
+{
+    char *kwlist[] = {first_name, "sep", "nthreads", "flags", "nheaders",
+                      "missing_int_val", "missing_float_val", "col_to_type",
+                      "return_stats", "trace", "filter", "group_by", "aggs",
+                      "return_summary", "na_values", "return_validity", "narrow",
+                      "decimals", "blocks", "ranges", "memory_limit", "spill_dir", "schema",
+                      "partition_by", "npartitions", "out", NULL};
+
+    opts->sep_obj = NULL;
+    opts->nthreads = 4;
+    opts->flags = 0;
+    opts->nheaders = 0;
+    opts->missing_int_val = 0;
+    opts->missing_float_val = 0.0;
+    opts->col_to_type = NULL;
+    opts->return_stats = 0;
+    opts->trace = NULL;
+    opts->filter = NULL;
+    opts->group_by = NULL;
+    opts->aggs = NULL;
+    opts->return_summary = 0;
+    opts->na_values = NULL;
+    opts->return_validity = 0;
+    opts->narrow = NARROW_OFF;
+    opts->decimals = NULL;
+    opts->blocks = 0;
+    opts->ranges = NULL;
+    opts->memory_limit = 0;
+    opts->spill_dir = NULL;
+    opts->schema = NULL;
+    opts->partition_by = NULL;
+    opts->npartitions = 0;
+    opts->out = NULL;
+
+    return PyArg_ParseTupleAndKeywords(args, kwds, "O|OiiiidOizOOOiOiiOiOnzOOiO", kwlist, first_obj,
+                                       &opts->sep_obj, &opts->nthreads, &opts->flags,
+                                       &opts->nheaders, &opts->missing_int_val,
+                                       &opts->missing_float_val, &opts->col_to_type,
+                                       &opts->return_stats, &opts->trace,
+                                       &opts->filter, &opts->group_by, &opts->aggs,
+                                       &opts->return_summary, &opts->na_values,
+                                       &opts->return_validity, &opts->narrow,
+                                       &opts->decimals, &opts->blocks, &opts->ranges,
+                                       &opts->memory_limit, &opts->spill_dir, &opts->schema,
+                                       &opts->partition_by, &opts->npartitions, &opts->out);
+}
+
+static const char *
+py_cstring(PyObject *str_obj)
+{
+#if PY_MAJOR_VERSION >= 3
+    return PyUnicode_AsUTF8(str_obj);
+#else
+    return PyString_AsString(str_obj);
+#endif
+}
+
+static const struct {
+    const char *name;
+    int op;
+} filter_ops[] = {
+    {"and", FILTER_AND}, {"or", FILTER_OR}, {"==", FILTER_EQ}, {"!=", FILTER_NE},
+    {"<", FILTER_LT}, {"<=", FILTER_LE}, {">", FILTER_GT}, {">=", FILTER_GE},
+    {"in", FILTER_IN}, {NULL, 0}
+};
+
+/* A column is a header name as bytes, or an index. */
+static int
+column_ref(PyObject *col_obj, int *col_idx, const uchar **col_name, size_t *col_name_len)
+{
+    if (PyBytes_Check(col_obj)) {
+        *col_idx = -1;
+        *col_name = (const uchar *)PyBytes_AS_STRING(col_obj);
+        *col_name_len = PyBytes_GET_SIZE(col_obj);
+        return 0;
+    }
+
+    *col_name = NULL;
+    *col_name_len = 0;
+    *col_idx = (int)PyLong_AsLong(col_obj);
+    if (*col_idx == -1 && PyErr_Occurred()) {
+        return -1;
+    }
+
+    return 0;
+}
+
+static void
+free_filter(FastCsvFilter *filter)
+{
+    int i;
+
+    for (i = 0; i < filter->nchildren; i++) {
+        free_filter(&filter->children[i]);
+    }
+    free(filter->children);
+    free(filter->values);
+}
+
+/* spec is from camog._filter.normalize, and must outlive the filter. */
+static int
+build_filter(PyObject *spec, FastCsvFilter *filter)
+{
+    PyObject *items;
+    const char *op;
+    Py_ssize_t n, i;
+
+    memset(filter, 0, sizeof(FastCsvFilter));
+    filter->col_idx = -1;
+
+    if (!PyTuple_Check(spec) || PyTuple_GET_SIZE(spec) < 2) {
+        PyErr_SetString(PyExc_ValueError, "invalid filter");
+        return -1;
+    }
+    if ((op = py_cstring(PyTuple_GET_ITEM(spec, 0))) == NULL) {
+        return -1;
+    }
+    for (i = 0; filter_ops[i].name != NULL; i++) {
+        if (strcmp(op, filter_ops[i].name) == 0) {
+            filter->op = filter_ops[i].op;
+            break;
+        }
+    }
+    if (filter->op == 0) {
+        PyErr_Format(PyExc_ValueError, "invalid filter op %s", op);
+        return -1;
+    }
+
+    items = PySequence_Fast(PyTuple_GET_ITEM(spec, PyTuple_GET_SIZE(spec) - 1),
+                            "expected a list");
+    if (items == NULL) {
+        return -1;
+    }
+    n = PySequence_Fast_GET_SIZE(items);
+
+    if (filter->op == FILTER_AND || filter->op == FILTER_OR) {
+        filter->children = (FastCsvFilter *)calloc(n, sizeof(FastCsvFilter));
+        filter->nchildren = (int)n;
+        for (i = 0; i < n; i++) {
+            if (build_filter(PySequence_Fast_GET_ITEM(items, i), &filter->children[i]) != 0) {
+                Py_DECREF(items);
+                return -1;
+            }
+        }
+        Py_DECREF(items);
+        return 0;
+    }
+
+    if (PyTuple_GET_SIZE(spec) != 3) {
+        Py_DECREF(items);
+        PyErr_SetString(PyExc_ValueError, "invalid filter");
+        return -1;
+    }
+
+    if (column_ref(PyTuple_GET_ITEM(spec, 1), &filter->col_idx, &filter->col_name,
+                   &filter->col_name_len) != 0) {
+        Py_DECREF(items);
+        return -1;
+    }
+
+    filter->values = (FastCsvValue *)calloc(n, sizeof(FastCsvValue));
+    filter->nvalues = (int)n;
+    for (i = 0; i < n; i++) {
+        PyObject *item = PySequence_Fast_GET_ITEM(items, i);
+        FastCsvValue *v = &filter->values[i];
+        if (PyBytes_Check(item)) {
+            v->type = COL_TYPE_STRING;
+            v->str = (const uchar *)PyBytes_AS_STRING(item);
+            v->len = PyBytes_GET_SIZE(item);
+        } else if (PyFloat_Check(item)) {
+            v->type = COL_TYPE_DOUBLE;
+            v->float_val = PyFloat_AS_DOUBLE(item);
+        } else {
+            v->type = COL_TYPE_INT64;
+            v->int_val = PyLong_AsLongLong(item);
+            if (v->int_val == -1 && PyErr_Occurred()) {
+                Py_DECREF(items);
+                return -1;
+            }
+        }
+    }
+
+    Py_DECREF(items);
+    return 0;
+}
+
+/* na_values is a list of bytes, and must outlive the tokens. */
+static FastCsvValue *
+build_na_tokens(PyObject *na_values, int *n_tokens)
+{
+    PyObject *items;
+    FastCsvValue *tokens;
+    Py_ssize_t n, i;
+
+    if ((items = PySequence_Fast(na_values, "expected a list of NA values")) == NULL) {
+        return NULL;
+    }
+    n = PySequence_Fast_GET_SIZE(items);
+
+    tokens = (FastCsvValue *)calloc(n + 1, sizeof(FastCsvValue));
+    for (i = 0; i < n; i++) {
+        PyObject *item = PySequence_Fast_GET_ITEM(items, i);
+        if (!PyBytes_Check(item)) {
+            PyErr_SetString(PyExc_TypeError, "NA values must be bytes");
+            free(tokens);
+            Py_DECREF(items);
+            return NULL;
+        }
+        tokens[i].type = COL_TYPE_STRING;
+        tokens[i].str = (const uchar *)PyBytes_AS_STRING(item);
+        tokens[i].len = PyBytes_GET_SIZE(item);
+    }
+
+    Py_DECREF(items);
+    *n_tokens = (int)n;
+    return tokens;
+}
+
+/* A type for each column, as in col_to_type. */
+static FastCsvSchemaColumn *
+build_schema(PyObject *schema_obj, int *ncols)
+{
+    PyObject *items;
+    FastCsvSchemaColumn *schema;
+    Py_ssize_t n, i;
+
+    if ((items = PySequence_Fast(schema_obj, "expected a list of column types")) == NULL) {
+        return NULL;
+    }
+    n = PySequence_Fast_GET_SIZE(items);
+    if (n == 0) {
+        PyErr_SetString(PyExc_ValueError, "schema needs at least one column");
+        Py_DECREF(items);
+        return NULL;
+    }
+
+    schema = (FastCsvSchemaColumn *)calloc(n + 1, sizeof(FastCsvSchemaColumn));
+    for (i = 0; i < n; i++) {
+        schema[i].type = column_type_from_py(PySequence_Fast_GET_ITEM(items, i),
+                                             &schema[i].width);
+        if (schema[i].type < 0) {
+            PyErr_Format(PyExc_TypeError, "schema column %zd has an unknown type", i);
+            free(schema);
+            Py_DECREF(items);
+            return NULL;
+        }
+    }
+
+    Py_DECREF(items);
+    *ncols = (int)n;
+    return schema;
+}
+
+static const struct {
+    const char *name;
+    int op;
+} agg_ops[] = {
+    {"count", AGG_COUNT}, {"sum", AGG_SUM}, {"min", AGG_MIN}, {"max", AGG_MAX},
+    {"mean", AGG_MEAN}, {NULL, 0}
+};
+
+static void
+free_aggregate(FastCsvAggregate *aggregate)
+{
+    free(aggregate->keys);
+    free(aggregate->aggs);
+}
+
+/* group_by is a list of columns, and aggs a list of (op, column) with
+   column None for count.  Both must outlive the aggregate. */
+static int
+build_aggregate(PyObject *group_by, PyObject *aggs, FastCsvAggregate *aggregate)
+{
+    PyObject *keys_seq, *aggs_seq;
+    Py_ssize_t i;
+    int j;
+    int rc = -1;
+
+    memset(aggregate, 0, sizeof(FastCsvAggregate));
+
+    if (group_by == Py_None) {
+        keys_seq = PyTuple_New(0);
+    } else {
+        keys_seq = PySequence_Fast(group_by, "expected a list of columns");
+    }
+    if (keys_seq == NULL) {
+        return -1;
+    }
+    if ((aggs_seq = PySequence_Fast(aggs, "expected a list of aggregates")) == NULL) {
+        Py_DECREF(keys_seq);
+        return -1;
+    }
+
+    aggregate->nkeys = (int)PySequence_Fast_GET_SIZE(keys_seq);
+    aggregate->keys = (FastCsvAggColumn *)calloc(aggregate->nkeys + 1, sizeof(FastCsvAggColumn));
+    for (i = 0; i < aggregate->nkeys; i++) {
+        FastCsvAggColumn *key = &aggregate->keys[i];
+        if (column_ref(PySequence_Fast_GET_ITEM(keys_seq, i), &key->col_idx,
+                       &key->col_name, &key->col_name_len) != 0) {
+            goto done;
+        }
+    }
+
+    aggregate->naggs = (int)PySequence_Fast_GET_SIZE(aggs_seq);
+    aggregate->aggs = (FastCsvAggColumn *)calloc(aggregate->naggs + 1, sizeof(FastCsvAggColumn));
+    for (i = 0; i < aggregate->naggs; i++) {
+        FastCsvAggColumn *agg = &aggregate->aggs[i];
+        PyObject *item = PySequence_Fast_GET_ITEM(aggs_seq, i);
+        const char *op;
+
+        if (!PyTuple_Check(item) || PyTuple_GET_SIZE(item) != 2) {
+            PyErr_SetString(PyExc_ValueError, "invalid aggregate");
+            goto done;
+        }
+        if ((op = py_cstring(PyTuple_GET_ITEM(item, 0))) == NULL) {
+            goto done;
+        }
+        for (j = 0; agg_ops[j].name != NULL; j++) {
+            if (strcmp(op, agg_ops[j].name) == 0) {
+                agg->op = agg_ops[j].op;
+                break;
+            }
+        }
+        if (agg->op == 0) {
+            PyErr_Format(PyExc_ValueError, "invalid aggregate op %s", op);
+            goto done;
+        }
+        if (PyTuple_GET_ITEM(item, 1) == Py_None) {
+            agg->col_idx = -1;
+        } else if (column_ref(PyTuple_GET_ITEM(item, 1), &agg->col_idx,
+                              &agg->col_name, &agg->col_name_len) != 0) {
+            goto done;
+        }
+    }
+
+    rc = 0;
+
+ done:
+    Py_DECREF(keys_seq);
+    Py_DECREF(aggs_seq);
+
+    return rc;
+}
+
+static PyObject *
+stats_to_dict(const FastCsvStats *stats)
+{
+    PyObject *chunks, *res;
+    int i;
+
+    if ((chunks = PyList_New(stats->nchunks)) == NULL) {
+        return NULL;
+    }
+    for (i = 0; i < stats->nchunks; i++) {
+        const FastCsvChunkStats *c = &stats->chunks[i];
+        PyObject *chunk = Py_BuildValue("{s:n,s:n,s:i,s:d,s:d,s:d,s:i,s:d,s:d,s:d}",
+                                        "nbytes", (Py_ssize_t)c->nbytes,
+                                        "nrows", (Py_ssize_t)c->nrows,
+                                        "stage1_thread", c->stage1_thread,
+                                        "stage1_wait", c->stage1_wait,
+                                        "stage1_begin", c->stage1_begin,
+                                        "stage1_end", c->stage1_end,
+                                        "fill_thread", c->fill_thread,
+                                        "fill_wait", c->fill_wait,
+                                        "fill_begin", c->fill_begin,
+                                        "fill_end", c->fill_end);
+        if (chunk == NULL) {
+            Py_DECREF(chunks);
+            return NULL;
+        }
+        PyList_SET_ITEM(chunks, i, chunk);  /* steals */
+    }
+
+    res = Py_BuildValue("{s:d,s:d,s:d,s:d,s:d,s:d,s:d,s:d,s:d,s:d,s:d,s:d,s:n,s:i,s:i,s:N}",
+                        "stage1_begin", stats->stage1_begin,
+                        "stage1_end", stats->stage1_end,
+                        "fixup_begin", stats->fixup_begin,
+                        "fixup_end", stats->fixup_end,
+                        "allocate_begin", stats->allocate_begin,
+                        "allocate_end", stats->allocate_end,
+                        "add_column_time", stats->add_column_time,
+                        "filter_begin", stats->filter_begin,
+                        "filter_end", stats->filter_end,
+                        "fill_begin", stats->fill_begin,
+                        "fill_end", stats->fill_end,
+                        "queue_wait", stats->queue_wait,
+                        "fixup_bytes", (Py_ssize_t)stats->fixup_bytes,
+                        "nchunks_reparsed", stats->nchunks_reparsed,
+                        "n_string_cols", stats->n_string_cols,
+                        "chunks", chunks);  /* N steals */
+
+    return res;
+}
+
+static PyObject *
+summary_to_list(const FastCsvSummary *summary)
+{
+    PyObject *res;
+    int i;
+
+    if ((res = PyList_New(summary->ncols)) == NULL) {
+        return NULL;
+    }
+    for (i = 0; i < summary->ncols; i++) {
+        const FastCsvColumnStats *c = &summary->columns[i];
+        PyObject *min_obj, *max_obj, *sum_obj, *col;
+
+        if (c->type == COL_TYPE_STRING) {
+            min_obj = Py_None;
+            max_obj = Py_None;
+            sum_obj = Py_None;
+            Py_INCREF(Py_None);
+            Py_INCREF(Py_None);
+            Py_INCREF(Py_None);
+        } else if (c->type == COL_TYPE_DOUBLE) {
+            min_obj = PyFloat_FromDouble(c->float_min);
+            max_obj = PyFloat_FromDouble(c->float_max);
+            sum_obj = PyFloat_FromDouble(c->float_sum);
+        } else {
+            min_obj = PyLong_FromLongLong(c->int_min);
+            max_obj = PyLong_FromLongLong(c->int_max);
+            sum_obj = PyLong_FromLongLong(c->int_sum);
+        }
+        if (c->count == 0) {
+            Py_XDECREF(min_obj);
+            Py_XDECREF(max_obj);
+            min_obj = Py_None;
+            max_obj = Py_None;
+            Py_INCREF(Py_None);
+            Py_INCREF(Py_None);
+        }
+
+        col = Py_BuildValue("{s:n,s:n,s:n,s:N,s:N,s:N,s:d}",
+                            "count", (Py_ssize_t)c->count,
+                            "nulls", (Py_ssize_t)c->nulls,
+                            "nans", (Py_ssize_t)c->nans,
+                            "min", min_obj,
+                            "max", max_obj,
+                            "sum", sum_obj,
+                            "ndistinct", c->ndistinct);  /* N steals refs */
+        if (col == NULL) {
+            Py_DECREF(res);
+            return NULL;
+        }
+        PyList_SET_ITEM(res, i, col);  /* steals */
+    }
+
+    return res;
+}
+
+static uchar
+options_sep(const PyFastCsvOptions *opts)
+{
+    if (opts->sep_obj == NULL) {
+        return ',';
+    }
+#if PY_MAJOR_VERSION >= 3
+    return PyUnicode_AsUTF8(opts->sep_obj)[0];  /* callee frees later */
+#else
+    return PyString_AsString(opts->sep_obj)[0];
+#endif
+}
+
+/* csv_buf and buf_len are already set. */
+static void
+init_input(FastCsvInput *input, uchar sep, const PyFastCsvOptions *opts)
+{
+    init_csv(input, input->csv_buf, input->buf_len, opts->nheaders, opts->nthreads);
+    input->sep = sep;
+    input->flags = opts->flags;
+    input->missing_int_val = opts->missing_int_val;
+    input->missing_float_val = opts->missing_float_val;
+    input->narrow = opts->narrow;
+    input->memory_limit = (opts->memory_limit > 0) ? (size_t)opts->memory_limit : 0;
+    input->spill_dir = opts->spill_dir;
+}
+
+/* Each partition's rows of the columns, as views. */
+static PyObject *
+partition_columns(PyObject *columns, const FastCsvPartition *partition)
+{
+    PyObject *parts, *part;
+    Py_ssize_t begin = 0, end;
+    Py_ssize_t col_idx;
+    int i;
+
+    if ((parts = PyList_New(partition->nparts)) == NULL) {
+        return NULL;
+    }
+    for (i = 0; i < partition->nparts; i++) {
+        end = begin + (Py_ssize_t)partition->nrows[i];
+        if ((part = PyList_New(PyList_GET_SIZE(columns))) == NULL) {
+            Py_DECREF(parts);
+            return NULL;
+        }
+        PyList_SET_ITEM(parts, i, part);  /* steals */
+        for (col_idx = 0; col_idx < PyList_GET_SIZE(columns); col_idx++) {
+            PyObject *view = PySequence_GetSlice(PyList_GET_ITEM(columns, col_idx), begin, end);
+            if (view == NULL) {
+                Py_DECREF(parts);
+                return NULL;
+            }
+            PyList_SET_ITEM(part, col_idx, view);  /* steals */
+        }
+        begin = end;
+    }
+
+    return parts;
+}
+
+static PyObject *
+py_parse_csv_multi(FastCsvInput *inputs, int ninputs, const PyFastCsvOptions *opts)
+{
+    uchar sep = options_sep(opts);
+    PyFastCsvResult result;
+    FastCsvStats stats;
+    FastCsvFilter filter;
+    FastCsvAggregate aggregate;
+    FastCsvSummary summary;
+    FastCsvPartition partition;
+    FastCsvValue *na_tokens = NULL;
+    int n_na_tokens = 0;
+    FastCsvSchemaColumn *schema = NULL;
+    int schema_ncols = 0;
+    PyObject *res_obj;
+    Py_ssize_t ncols;
+    int i, rc, res_idx, return_scales;
+
+    for (i = 0; i < ninputs; i++) {
+        init_input(&inputs[i], sep, opts);
+    }
+    if (opts->return_stats) {
+        inputs[0].stats = &stats;
+    }
+    if (opts->return_summary) {
+        inputs[0].summary = &summary;
+    }
+    inputs[0].trace_filename = opts->trace;
+    if (opts->na_values != NULL && opts->na_values != Py_None) {
+        if ((na_tokens = build_na_tokens(opts->na_values, &n_na_tokens)) == NULL) {
+            return NULL;
+        }
+        inputs[0].n_na_tokens = n_na_tokens;
+        inputs[0].na_tokens = na_tokens;
+    }
+    if (opts->schema != NULL && opts->schema != Py_None) {
+        if ((schema = build_schema(opts->schema, &schema_ncols)) == NULL) {
+            free(na_tokens);
+            return NULL;
+        }
+        inputs[0].schema_ncols = schema_ncols;
+        inputs[0].schema = schema;
+    }
+    if (opts->partition_by != NULL && opts->partition_by != Py_None) {
+        if (column_ref(opts->partition_by, &partition.col_idx, &partition.col_name,
+                       &partition.col_name_len) != 0) {
+            free(schema);
+            free(na_tokens);
+            return NULL;
+        }
+        partition.nparts = opts->npartitions;
+        inputs[0].partition = &partition;
+    }
+    if (opts->filter != NULL && opts->filter != Py_None) {
+        if (build_filter(opts->filter, &filter) != 0) {
+            free_filter(&filter);
+            free(schema);
+            free(na_tokens);
+            return NULL;
+        }
+        inputs[0].filter = &filter;
+    }
+    if (opts->aggs != NULL && opts->aggs != Py_None) {
+        if (build_aggregate((opts->group_by == NULL) ? Py_None : opts->group_by, opts->aggs,
+                            &aggregate) != 0) {
+            free_aggregate(&aggregate);
+            if (inputs[0].filter != NULL) {
+                free_filter(&filter);
+            }
+            free(schema);
+            free(na_tokens);
+            return NULL;
+        }
+        inputs[0].aggregate = &aggregate;
+    }
+
+    result.r.add_header = &py_add_header;
+    result.r.add_column = &py_add_column;
+    result.r.fix_column_type = &py_fix_column_type;
+    result.r.add_validity = opts->return_validity ? &py_add_validity : NULL;
+    result.r.fix_decimal_scale = &py_fix_decimal_scale;
+#ifndef _WIN32
+    result.r.add_mapped_column = (opts->blocks || (opts->out != NULL && opts->out != Py_None))
+        ? NULL : &py_add_mapped_column;
+#else
+    result.r.add_mapped_column = NULL;
+#endif
+    if (opts->nheaders == 0) {
+        Py_INCREF(Py_None);
+        result.headers = Py_None;
+    } else {
+        result.headers = PyList_New(0);
+    }
+    result.columns = PyList_New(0);
+    result.validity = PyList_New(0);
+    result.col_to_type = opts->col_to_type;
+    result.decimals = opts->decimals;
+    result.scales = PyList_New(0);
+    result.blocks = opts->blocks;
+    result.out = (opts->out != NULL && opts->out != Py_None) ? opts->out : NULL;
+    result.col_types = PyList_New(0);
+    for (i = 0; i <= COL_TYPE_DECIMAL; i++) {
+        result.block_arrs[i] = NULL;
+    }
+
+    if (inputs[0].partition != NULL) {
+        partition.nrows = (size_t *)calloc(partition.nparts, sizeof(size_t));
+    }
+
+    rc = parse_csv_multi(inputs, ninputs, (FastCsvResult *)&result);
+
+    Py_DECREF(result.col_types);
+    for (i = 0; i <= COL_TYPE_DECIMAL; i++) {
+        Py_XDECREF(result.block_arrs[i]);  /* the columns keep them */
+    }
+
+    free(na_tokens);
+    free(schema);
+    if (inputs[0].filter != NULL) {
+        free_filter(&filter);
+    }
+    if (inputs[0].aggregate != NULL) {
+        free_aggregate(&aggregate);
+    }
+
+    if (rc == FASTCSV_ERR_TRACE) {
+        const char *trace = (opts->trace != NULL) ? opts->trace : getenv("CAMOG_TRACE");
+        rc = PyErr_WarnFormat(PyExc_RuntimeWarning, 1, "could not write trace %s", trace);
+    }
+
+    if (rc == 0 && inputs[0].partition != NULL) {
+        PyObject *parts = partition_columns(result.columns, &partition);
+        if (parts == NULL) {
+            rc = -1;
+        } else {
+            ncols = PyList_GET_SIZE(result.columns);
+            Py_DECREF(result.columns);
+            result.columns = parts;
+        }
+    } else {
+        ncols = PyList_GET_SIZE(result.columns);
+    }
+    if (inputs[0].partition != NULL) {
+        free(partition.nrows);
+    }
+
+    if (rc != 0) {
+        if (opts->return_stats) {
+            free_csv_stats(&stats);
+        }
+        if (opts->return_summary) {
+            free_csv_summary(&summary);
+        }
+        if (rc == FASTCSV_ERR_FILTER_COLUMN) {
+            PyErr_SetString(PyExc_ValueError, "filter column is not in the csv");
+        } else if (rc == FASTCSV_ERR_FILTER_TYPE) {
+            PyErr_SetString(PyExc_TypeError,
+                            "filter compares a string column with a number, or a number column with a string");
+        } else if (rc == FASTCSV_ERR_AGG_COLUMN) {
+            PyErr_SetString(PyExc_ValueError, "aggregate column is not in the csv");
+        } else if (rc == FASTCSV_ERR_AGG_TYPE) {
+            PyErr_SetString(PyExc_TypeError, "cannot aggregate a string column");
+        } else if (rc == FASTCSV_ERR_PARTITION_COLUMN) {
+            PyErr_SetString(PyExc_ValueError, "partition column is not in the csv");
+        } else if (rc == FASTCSV_ERR_HEADERS) {
+            PyErr_SetString(PyExc_ValueError, "the files do not have the same header line");
+        }
+        Py_DECREF(result.headers);
+        Py_DECREF(result.columns);
+        Py_DECREF(result.validity);
+        Py_DECREF(result.scales);
+        return NULL;
+    }
+
+    return_scales = (opts->decimals != NULL && opts->decimals != Py_None);
+    res_obj = PyTuple_New(2 + (opts->return_stats != 0) + (opts->return_summary != 0)
+                          + return_scales + (opts->return_validity != 0));
+    PyTuple_SET_ITEM(res_obj, 0, result.headers);
+    PyTuple_SET_ITEM(res_obj, 1, result.columns);
+    res_idx = 2;
+    if (opts->return_stats) {
+        PyObject *stats_obj = stats_to_dict(&stats);
+        free_csv_stats(&stats);
+        if (stats_obj == NULL) {
+            if (opts->return_summary) {
+                free_csv_summary(&summary);
+            }
+            Py_DECREF(result.validity);
+            Py_DECREF(result.scales);
+            Py_DECREF(res_obj);
+            return NULL;
+        }
+        PyTuple_SET_ITEM(res_obj, res_idx++, stats_obj);
+    }
+    if (opts->return_summary) {
+        PyObject *summary_obj = summary_to_list(&summary);
+        free_csv_summary(&summary);
+        if (summary_obj == NULL) {
+            Py_DECREF(result.validity);
+            Py_DECREF(result.scales);
+            Py_DECREF(res_obj);
+            return NULL;
+        }
+        PyTuple_SET_ITEM(res_obj, res_idx++, summary_obj);
+    }
+    if (return_scales) {
+        while (PyList_GET_SIZE(result.scales) < ncols) {
+            PyList_Append(result.scales, Py_None);
+        }
+        PyTuple_SET_ITEM(res_obj, res_idx++, result.scales);
+    } else {
+        Py_DECREF(result.scales);
+    }
+    if (opts->return_validity) {
+        while (PyList_GET_SIZE(result.validity) < ncols) {
+            PyList_Append(result.validity, Py_None);
+        }
+        PyTuple_SET_ITEM(res_obj, res_idx, result.validity);
+    } else {
+        Py_DECREF(result.validity);
+    }
+
+    return res_obj;
+}
+
+static PyObject *
+py_parse_csv(const uchar *csv_buf, size_t buf_len, const PyFastCsvOptions *opts)
+{
+    FastCsvInput input;
+
+    input.csv_buf = csv_buf;
+    input.buf_len = buf_len;
+
+    return py_parse_csv_multi(&input, 1, opts);
+}
+
+static PyObject *
+parse_csv_func(PyObject *self, PyObject *args, PyObject *kwds)
+{
+    PyObject *str_obj;
+    PyFastCsvOptions opts;
+    const uchar *csv_buf;
+    Py_ssize_t buf_len;
+
+    if (!parse_options(args, kwds, "csv", &str_obj, &opts)) {
+        return NULL;
+    }
+
+#if PY_MAJOR_VERSION >= 3
+    if (PyBytes_Check(str_obj)) {
+        PyBytes_AsStringAndSize(str_obj, (char **)&csv_buf, &buf_len);
+    } else {
+        csv_buf = (uchar *)PyUnicode_AsUTF8AndSize(str_obj, &buf_len);
+    }
+#else
+    PyString_AsStringAndSize(str_obj, (char **)&csv_buf, &buf_len);
+#endif
+
+    return py_parse_csv(csv_buf, buf_len, &opts);
+}
+
+/* Parse (begin, end) byte ranges of the file into one set of columns.
+   Each must begin at the start of a row. */
+static PyObject *
+py_parse_ranges(const MappedFile *mapped, PyObject *ranges, const PyFastCsvOptions *opts)
+{
+    PyObject *res;
+    FastCsvInput *inputs;
+    Py_ssize_t nranges, i;
+
+    if ((ranges = PySequence_Fast(ranges, "expected a sequence of byte ranges")) == NULL) {
+        return NULL;
+    }
+    nranges = PySequence_Fast_GET_SIZE(ranges);
+    if (nranges == 0) {
+        Py_DECREF(ranges);
+        return PyErr_Format(PyExc_ValueError, "no ranges to parse");
+    }
+
+    inputs = (FastCsvInput *)malloc(nranges * sizeof(FastCsvInput));
+    for (i = 0; i < nranges; i++) {
+        Py_ssize_t begin, end;
+        if (!PyArg_ParseTuple(PySequence_Fast_GET_ITEM(ranges, i), "nn", &begin, &end)) {
+            free(inputs);
+            Py_DECREF(ranges);
+            return NULL;
+        }
+        if (begin < 0 || begin > end || (size_t)end > mapped->size) {
+            free(inputs);
+            Py_DECREF(ranges);
+            return PyErr_Format(PyExc_ValueError, "range %zd to %zd is not in the file",
+                                begin, end);
+        }
+        inputs[i].csv_buf = (const uchar *)mapped->data + begin;
+        inputs[i].buf_len = end - begin;
+    }
+
+    res = py_parse_csv_multi(inputs, (int)nranges, opts);
+
+    free(inputs);
+    Py_DECREF(ranges);
+
+    return res;
+}
+
+static PyObject *
+parse_file_func(PyObject *self, PyObject *args, PyObject *kwds)
+{
+    PyObject *fname_obj;
+    PyFastCsvOptions opts;
+    PyObject *res;
+    MappedFile mapped;
+    const char *fname;
+
+    if (!parse_options(args, kwds, "filename", &fname_obj, &opts)) {
+        return NULL;
+    }
+
+    if ((fname = py_cstring(fname_obj)) == NULL) {
+        return NULL;
+    }
+    if (map_file(fname, &mapped) != 0) {
+        return NULL;
+    }
+
+    if (opts.ranges != NULL && opts.ranges != Py_None) {
+        res = py_parse_ranges(&mapped, opts.ranges, &opts);
+    } else {
+        res = py_parse_csv(mapped.data, mapped.size, &opts);
+    }
+
+    unmap_file(&mapped);
+
+    return res;
+}
+
+static PyObject *
+parse_files_func(PyObject *self, PyObject *args, PyObject *kwds)
+{
+    PyObject *fnames_obj;
+    PyFastCsvOptions opts;
+    PyObject *res = NULL;
+    MappedFile *mapped;
+    FastCsvInput *inputs;
+    Py_ssize_t nfiles, nmapped, i;
+
+    if (!parse_options(args, kwds, "filenames", &fnames_obj, &opts)) {
+        return NULL;
+    }
+
+    if ((fnames_obj = PySequence_Fast(fnames_obj, "expected a sequence of filenames")) == NULL) {
+        return NULL;
+    }
+    nfiles = PySequence_Fast_GET_SIZE(fnames_obj);
+    if (nfiles == 0) {
+        Py_DECREF(fnames_obj);
+        return PyErr_Format(PyExc_ValueError, "no files to parse");
+    }
+
+    mapped = (MappedFile *)malloc(nfiles * sizeof(MappedFile));
+    inputs = (FastCsvInput *)malloc(nfiles * sizeof(FastCsvInput));
+
+    for (nmapped = 0; nmapped < nfiles; nmapped++) {
+        const char *fname = py_cstring(PySequence_Fast_GET_ITEM(fnames_obj, nmapped));
+        if (fname == NULL || map_file(fname, &mapped[nmapped]) != 0) {
+            goto done;
+        }
+        inputs[nmapped].csv_buf = mapped[nmapped].data;
+        inputs[nmapped].buf_len = mapped[nmapped].size;
+    }
+
+    /* each file is read ahead as the one before it starts */
+    opts.flags |= FLAG_READ_AHEAD;
+    res = py_parse_csv_multi(inputs, (int)nfiles, &opts);
+
+ done:
+    for (i = 0; i < nmapped; i++) {
+        unmap_file(&mapped[i]);
+    }
+    free(inputs);
+    free(mapped);
+    Py_DECREF(fnames_obj);
+
+    return res;
+}
+
+/* A FastCsvTable and the file under it, in a capsule. */
+typedef struct {
+    FastCsvTable *table;
+    MappedFile mapped;
+    FastCsvValue *na_tokens;
+    PyObject *na_values;  /* owns the NA token strings */
+} PyFastCsvTable;
+
+#define TABLE_CAPSULE "camog._cfastcsv.table"
+
+static void
+free_table(PyObject *capsule)
+{
+    PyFastCsvTable *pytable = (PyFastCsvTable *)PyCapsule_GetPointer(capsule, TABLE_CAPSULE);
+
+    close_csv(pytable->table);
+    unmap_file(&pytable->mapped);
+    free(pytable->na_tokens);
+    Py_XDECREF(pytable->na_values);
+    free(pytable);
+}
+
+static PyObject *
+open_file_func(PyObject *self, PyObject *args, PyObject *kwds)
+{
+    PyObject *fname_obj;
+    PyFastCsvOptions opts;
+    PyFastCsvTable *pytable;
+    PyFastCsvResult result;
+    FastCsvInput input;
+    PyObject *capsule;
+    const char *fname;
+
+    if (!parse_options(args, kwds, "filename", &fname_obj, &opts)) {
+        return NULL;
+    }
+
+    if ((fname = py_cstring(fname_obj)) == NULL) {
+        return NULL;
+    }
+
+    pytable = (PyFastCsvTable *)calloc(1, sizeof(PyFastCsvTable));
+    if (map_file(fname, &pytable->mapped) != 0) {
+        free(pytable);
+        return NULL;
+    }
+
+    input.csv_buf = pytable->mapped.data;
+    input.buf_len = pytable->mapped.size;
+    init_input(&input, options_sep(&opts), &opts);
+    if (opts.na_values != NULL && opts.na_values != Py_None) {
+        if ((pytable->na_tokens = build_na_tokens(opts.na_values, &input.n_na_tokens)) == NULL) {
+            unmap_file(&pytable->mapped);
+            free(pytable);
+            return NULL;
+        }
+        input.na_tokens = pytable->na_tokens;
+        Py_INCREF(opts.na_values);
+        pytable->na_values = opts.na_values;
+    }
+
+    memset(&result, 0, sizeof(result));
+    result.r.add_header = &py_add_header;
+    result.r.fix_column_type = &py_fix_column_type;
+    if (opts.nheaders == 0) {
+        Py_INCREF(Py_None);
+        result.headers = Py_None;
+    } else {
+        result.headers = PyList_New(0);
+    }
+    result.col_to_type = opts.col_to_type;
+
+    if ((pytable->table = open_csv(&input, (FastCsvResult *)&result)) == NULL) {
+        Py_DECREF(result.headers);
+        unmap_file(&pytable->mapped);
+        free(pytable->na_tokens);
+        Py_XDECREF(pytable->na_values);
+        free(pytable);
+        return NULL;
+    }
+
+    if ((capsule = PyCapsule_New(pytable, TABLE_CAPSULE, &free_table)) == NULL) {
+        Py_DECREF(result.headers);
+        close_csv(pytable->table);
+        unmap_file(&pytable->mapped);
+        free(pytable->na_tokens);
+        Py_XDECREF(pytable->na_values);
+        free(pytable);
+        return NULL;
+    }
+
+    return Py_BuildValue("NNni", result.headers, capsule,
+                         (Py_ssize_t)csv_table_nrows(pytable->table),
+                         csv_table_ncols(pytable->table));
+}
+
+static PyObject *
+fill_column_func(PyObject *self, PyObject *args)
+{
+    PyObject *capsule;
+    PyFastCsvTable *pytable;
+    PyFastCsvResult result;
+    PyObject *arr;
+    int col_idx;
+
+    if (!PyArg_ParseTuple(args, "Oi", &capsule, &col_idx)) {
+        return NULL;
+    }
+    if ((pytable = (PyFastCsvTable *)PyCapsule_GetPointer(capsule, TABLE_CAPSULE)) == NULL) {
+        return NULL;
+    }
+    if (col_idx < 0 || col_idx >= csv_table_ncols(pytable->table)) {
+        return PyErr_Format(PyExc_IndexError, "no column %d", col_idx);
+    }
+
+    memset(&result, 0, sizeof(result));
+    result.r.add_column = &py_add_column;
+    result.columns = PyList_New(0);
+
+    if (fill_csv_column(pytable->table, col_idx, (FastCsvResult *)&result) != 0) {
+        Py_DECREF(result.columns);
+        return PyErr_NoMemory();
+    }
+
+    arr = PyList_GET_ITEM(result.columns, 0);
+    Py_INCREF(arr);
+    Py_DECREF(result.columns);
+
+    return arr;
+}
+
+static PyObject *
+row_offsets_func(PyObject *self, PyObject *args)
+{
+    PyObject *capsule;
+    PyFastCsvTable *pytable;
+    PyObject *arr;
+    Py_ssize_t step;
+    npy_intp dims[1], i;
+    size_t *offsets;
+
+    if (!PyArg_ParseTuple(args, "On", &capsule, &step)) {
+        return NULL;
+    }
+    if ((pytable = (PyFastCsvTable *)PyCapsule_GetPointer(capsule, TABLE_CAPSULE)) == NULL) {
+        return NULL;
+    }
+    if (step <= 0) {
+        return PyErr_Format(PyExc_ValueError, "step must be positive");
+    }
+
+    dims[0] = (csv_table_nrows(pytable->table) + step - 1) / step;
+    if ((arr = PyArray_SimpleNew(1, dims, NPY_UINT64)) == NULL) {
+        return NULL;
+    }
+    offsets = (size_t *)malloc((dims[0] + 1) * sizeof(size_t));
+    csv_table_row_offsets(pytable->table, step, offsets);
+    for (i = 0; i < dims[0]; i++) {
+        ((npy_uint64 *)PyArray_DATA((PyArrayObject *)arr))[i] = offsets[i];
+    }
+    free(offsets);
+
+    return arr;
+}
+
+static PyObject *
+table_info_func(PyObject *self, PyObject *args)
+{
+    PyObject *capsule;
+    PyFastCsvTable *pytable;
+    PyObject *descrs, *widths, *nquoted;
+    FastCsvColumnInfo info;
+    size_t fixup_bytes;
+    int nchunks_reparsed;
+    int ncols, col_idx;
+
+    if (!PyArg_ParseTuple(args, "O", &capsule)) {
+        return NULL;
+    }
+    if ((pytable = (PyFastCsvTable *)PyCapsule_GetPointer(capsule, TABLE_CAPSULE)) == NULL) {
+        return NULL;
+    }
+
+    ncols = csv_table_ncols(pytable->table);
+    descrs = PyList_New(ncols);
+    widths = PyList_New(ncols);
+    nquoted = PyList_New(ncols);
+    for (col_idx = 0; col_idx < ncols; col_idx++) {
+        csv_table_column_info(pytable->table, col_idx, &info);
+        PyList_SET_ITEM(descrs, col_idx,  /* steals */
+                        (PyObject *)PyArray_DescrFromType(npy_type(info.type)));
+        PyList_SET_ITEM(widths, col_idx, PyLong_FromSize_t(info.width));
+        PyList_SET_ITEM(nquoted, col_idx, PyLong_FromSize_t(info.nquoted));
+    }
+    fixup_bytes = csv_table_fixup_bytes(pytable->table, &nchunks_reparsed);
+
+    return Py_BuildValue("NNNni", descrs, widths, nquoted, (Py_ssize_t)fixup_bytes,
+                         nchunks_reparsed);
+}
+
+static int
+column_for_array(PyObject *arr_obj, PyObject *valid_obj, size_t nrows, FastCsvColumn *column)
+{
+    PyArrayObject *arr = (PyArrayObject *)arr_obj;
+
+    if (!PyArray_Check(arr_obj) || PyArray_NDIM(arr) != 1 || !PyArray_IS_C_CONTIGUOUS(arr)
+        || (size_t)PyArray_DIM(arr, 0) != nrows) {
+        PyErr_SetString(PyExc_ValueError, "columns must be contiguous arrays of the same length");
+        return -1;
+    }
+    if (!PyArray_ISNOTSWAPPED(arr)) {
+        PyErr_SetString(PyExc_ValueError, "columns must be in native byte order");
+        return -1;
+    }
+
+    switch (PyArray_TYPE(arr)) {
+    case NPY_INT8:
+        column->type = COL_TYPE_INT8;
+        break;
+    case NPY_INT16:
+        column->type = COL_TYPE_INT16;
+        break;
+    case NPY_INT32:
+        column->type = COL_TYPE_INT32;
+        break;
+    case NPY_INT64:
+        column->type = COL_TYPE_INT64;
+        break;
+    case NPY_FLOAT32:
+        column->type = COL_TYPE_FLOAT32;
+        break;
+    case NPY_FLOAT64:
+        column->type = COL_TYPE_DOUBLE;
+        break;
+    case NPY_STRING:
+        column->type = COL_TYPE_STRING;
+        break;
+    default:
+        PyErr_SetString(PyExc_TypeError, "cannot write column of this type");
+        return -1;
+    }
+    column->data = PyArray_DATA(arr);
+    column->width = PyArray_ITEMSIZE(arr);
+
+    column->validity = NULL;
+    if (valid_obj != NULL && valid_obj != Py_None) {
+        if (!PyArray_Check(valid_obj) || PyArray_TYPE((PyArrayObject *)valid_obj) != NPY_UINT8
+            || !PyArray_IS_C_CONTIGUOUS((PyArrayObject *)valid_obj)
+            || (size_t)PyArray_NBYTES((PyArrayObject *)valid_obj) < (nrows + 7) / 8) {
+            PyErr_SetString(PyExc_ValueError, "invalid validity bitmap");
+            return -1;
+        }
+        column->validity = (const uchar *)PyArray_DATA((PyArrayObject *)valid_obj);
+    }
+
+    return 0;
+}
+
+static PyObject *
+write_file_func(PyObject *self, PyObject *args, PyObject *kwds)
+{
+    char *kwlist[] = {"filename", "columns", "headers", "validity", "sep", "nthreads", NULL};
+    const char *fname;
+    PyObject *columns_obj, *headers_obj = Py_None, *validity_obj = Py_None;
+    PyObject *sep_obj = NULL;
+    PyObject *res = NULL;
+    FastCsvOutput output;
+    FastCsvColumn *columns = NULL;
+    FastCsvValue *headers = NULL;
+    Py_ssize_t ncols, i;
+    int nthreads = 4;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "sO|OOOi", kwlist, &fname, &columns_obj,
+                                     &headers_obj, &validity_obj, &sep_obj, &nthreads)) {
+        return NULL;
+    }
+
+    if ((columns_obj = PySequence_Fast(columns_obj, "expected a list of columns")) == NULL) {
+        return NULL;
+    }
+    ncols = PySequence_Fast_GET_SIZE(columns_obj);
+
+    output.sep = ',';
+    if (sep_obj != NULL) {
+        const char *sep = py_cstring(sep_obj);
+        if (sep == NULL) {
+            goto done;
+        }
+        output.sep = sep[0];
+    }
+    output.nthreads = nthreads;
+    output.ncols = (int)ncols;
+    output.nrows = 0;
+    output.headers = NULL;
+    if (ncols > 0) {
+        PyObject *first = PySequence_Fast_GET_ITEM(columns_obj, 0);
+        if (!PyArray_Check(first)) {
+            PyErr_SetString(PyExc_ValueError, "columns must be numpy arrays");
+            goto done;
+        }
+        output.nrows = PyArray_SIZE((PyArrayObject *)first);
+    }
+
+    columns = (FastCsvColumn *)calloc(ncols + 1, sizeof(FastCsvColumn));
+    for (i = 0; i < ncols; i++) {
+        PyObject *valid_obj = NULL;
+        if (validity_obj != Py_None) {
+            if ((valid_obj = PySequence_GetItem(validity_obj, i)) == NULL) {
+                goto done;
+            }
+            Py_DECREF(valid_obj);  /* still held by the sequence */
+        }
+        if (column_for_array(PySequence_Fast_GET_ITEM(columns_obj, i), valid_obj,
+                             output.nrows, &columns[i]) != 0) {
+            goto done;
+        }
+    }
+    output.columns = columns;
+
+    if (headers_obj != Py_None) {
+        if (PySequence_Size(headers_obj) != ncols) {
+            PyErr_SetString(PyExc_ValueError, "need a header for each column");
+            goto done;
+        }
+        headers = (FastCsvValue *)calloc(ncols + 1, sizeof(FastCsvValue));
+        for (i = 0; i < ncols; i++) {
+            PyObject *header = PySequence_GetItem(headers_obj, i);
+            if (header == NULL) {
+                goto done;
+            }
+            Py_DECREF(header);  /* still held by the sequence */
+            if (!PyBytes_Check(header)) {
+                PyErr_SetString(PyExc_TypeError, "headers must be bytes");
+                goto done;
+            }
+            headers[i].type = COL_TYPE_STRING;
+            headers[i].str = (const uchar *)PyBytes_AS_STRING(header);
+            headers[i].len = PyBytes_GET_SIZE(header);
+        }
+        output.headers = headers;
+    }
+
+    if (write_csv(&output, fname) != 0) {
+        PyErr_SetFromErrnoWithFilename(PyExc_IOError, fname);
+        goto done;
+    }
+
+    Py_INCREF(Py_None);
+    res = Py_None;
+
+ done:
+    free(headers);
+    free(columns);
+    Py_DECREF(columns_obj);
 
     return res;
 }
 
 static PyMethodDef mod_methods[] = {
-    {"parse_csv", (PyCFunction)parse_csv_func, METH_VARARGS,
+    {"parse_csv", (PyCFunction)parse_csv_func, METH_VARARGS | METH_KEYWORDS,
      "Parse csv"},
-    {"parse_file", (PyCFunction)parse_file_func, METH_VARARGS,
+    {"parse_file", (PyCFunction)parse_file_func, METH_VARARGS | METH_KEYWORDS,
      "Parse csv file"},
+    {"parse_files", (PyCFunction)parse_files_func, METH_VARARGS | METH_KEYWORDS,
+     "Parse csv files into one set of columns"},
+    {"write_file", (PyCFunction)write_file_func, METH_VARARGS | METH_KEYWORDS,
+     "Write columns as a csv file"},
+    {"open_file", (PyCFunction)open_file_func, METH_VARARGS | METH_KEYWORDS,
+     "Find the rows and column types of a csv file, without filling the columns"},
+    {"fill_column", (PyCFunction)fill_column_func, METH_VARARGS,
+     "Fill one column of a table from open_file"},
+    {"row_offsets", (PyCFunction)row_offsets_func, METH_VARARGS,
+     "Byte offsets of every step-th row of a table from open_file"},
+    {"table_info", (PyCFunction)table_info_func, METH_VARARGS,
+     "Column types, widths and quoted cell counts of a table from open_file"},
     {NULL}  /* Sentinel */
 };
 
@@ -0,0 +1,156 @@
+# Copyright 2026 Ben Walsh
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import numpy as np
+import pytest
+
+import camog
+
+import _testhelper as th
+
+def _data(nrows):
+    syms = ['AAA', 'BB', '"C,C"', '"D\nD"']
+    return 'sym,day,qty,px\n' + ''.join('%s,%d,%d,%s\n' % (syms[i * 7 % 4], i % 3, i,
+                                                          '' if i % 11 == 0 else '%d.25' % (i % 13))
+                                        for i in range(nrows))
+
+
+def _expected(cols, key_idxs, agg_specs):
+    groups = {}
+    order = []
+    nrows = len(cols[0])
+    for row in range(nrows):
+        key = tuple(cols[k][row] for k in key_idxs)
+        if key not in groups:
+            groups[key] = []
+            order.append(key)
+        groups[key].append(row)
+
+    res = [np.array([key[i] for key in order]) for i in range(len(key_idxs))]
+    for op, col in agg_specs:
+        vals = []
+        for key in order:
+            rows = groups[key]
+            if col is None:
+                vals.append(len(rows))
+                continue
+            present = np.ma.compressed(cols[col][rows])
+            if op == 'count':
+                vals.append(len(present))
+            else:
+                vals.append(getattr(np, op)(present))
+        res.append(np.array(vals))
+    return res
+
+
+@pytest.mark.parametrize('nthreads', [1, 3, 8])
+def test_aggregate_grouped(nthreads):
+    data = _data(2000)
+    aggs = [('count', None), ('sum', 2), ('min', 3), ('max', 3), ('mean', 2), ('sum', 3),
+            ('mean', 3), ('count', 3)]
+    with th.TempCsvFile(data) as fname:
+        _, cols = camog.load(fname, nthreads=nthreads, validity='mask')
+        headers, res = camog.aggregate(fname, group_by=['sym', 'day'],
+                                       aggs=['count', ('sum', 'qty'), ('min', 'px'),
+                                             ('max', 'px'), ('mean', 'qty'), ('sum', 3),
+                                             ('mean', 'px'), ('count', 'px')],
+                                       nthreads=nthreads)
+
+    assert headers == ['sym', 'day', 'count', 'sum(qty)', 'min(px)', 'max(px)',
+                       'mean(qty)', 'sum(px)', 'mean(px)', 'count(px)']
+    expected = _expected(cols, [0, 1], aggs)
+    assert len(res) == len(expected)
+    for col, exp in zip(res, expected):
+        assert np.allclose(col, exp) if col.dtype.kind == 'f' else np.array_equal(col, exp)
+    assert not np.array_equal(res[2], res[9])
+    assert res[2].dtype == np.int64
+    assert res[3].dtype == np.int64
+    assert res[4].dtype == np.float64
+
+
+def test_aggregate_global():
+    data = _data(500)
+    with th.TempCsvFile(data) as fname:
+        _, cols = camog.load(fname)
+        headers, res = camog.aggregate(fname, aggs=['count', ('sum', 'qty'), ('max', 'day')])
+
+    assert headers == ['count', 'sum(qty)', 'max(day)']
+    assert res[0][0] == 500
+    assert res[1][0] == cols[2].sum()
+    assert res[2][0] == 2
+
+
+def test_aggregate_filter():
+    data = _data(1000)
+    with th.TempCsvFile(data) as fname:
+        _, cols = camog.load(fname, filter=('>=', 'qty', 400))
+        headers, res = camog.aggregate(fname, 'sym', [('sum', 'qty')],
+                                       filter=('>=', 'qty', 400))
+
+    expected = _expected(cols, [0], [('sum', 2)])
+    assert np.array_equal(res[0], expected[0])
+    assert np.array_equal(res[1], expected[1])
+
+
+def test_aggregate_nan():
+    data = 'k,v\n1,nan\n1,2.0\n2,nan\n1,-1.0\n'
+    with th.TempCsvFile(data) as fname:
+        headers, res = camog.aggregate(fname, 'k', [('min', 'v'), ('max', 'v')])
+
+    assert np.array_equal(res[0], np.array([1, 2]))
+    assert np.array_equal(res[1][:1], np.array([-1.0]))
+    assert np.array_equal(res[2][:1], np.array([2.0]))
+    assert np.isnan(res[1][1]) and np.isnan(res[2][1])
+
+
+def test_aggregate_no_rows():
+    with th.TempCsvFile('a,b\n') as fname:
+        headers, res = camog.aggregate(fname, 'a', ['count', ('sum', 'b')])
+
+    assert headers == ['a', 'count', 'sum(b)']
+    assert [len(c) for c in res] == [0, 0, 0]
+
+
+def test_aggregate_errors():
+    with th.TempCsvFile(_data(10)) as fname:
+        with pytest.raises(ValueError):
+            camog.aggregate(fname, 'nosuch')
+        with pytest.raises(ValueError):
+            camog.aggregate(fname, aggs=[('sum', 'nosuch')])
+        with pytest.raises(ValueError):
+            camog.aggregate(fname, aggs=[('median', 'qty')])
+        with pytest.raises(TypeError):
+            camog.aggregate(fname, aggs=[('sum', 'sym')])
+
+
+def test_aggregate_nulls():
+    data = 'k,v,f,s\na,10,1.5,x\na,,,\nb,4,NA,y\nc,,NA,\na,NA,0.5,NA\n'
+    aggs = [('count', 'v'), ('sum', 'v'), ('min', 'v'), ('max', 'v'), ('mean', 'v'),
+            ('mean', 'f'), ('count', 's')]
+    with th.TempCsvFile(data) as fname:
+        headers, res = camog.aggregate(fname, 'k', ['count'] + aggs, na_values=['NA'],
+                                       missing_int_val=-1)
+        _, totals = camog.aggregate(fname, aggs=['count'] + aggs, na_values=['NA'], nthreads=3)
+
+    assert res[0].tolist() == [b'a', b'b', b'c']
+    assert res[1].tolist() == [3, 1, 1]
+    assert res[2].tolist() == [1, 1, 0]
+    assert res[3].tolist() == [10, 4, 0]
+    assert res[4].tolist() == [10, 4, -1]
+    assert res[5].tolist() == [10, 4, -1]
+    assert res[6][:2].tolist() == [10.0, 4.0] and np.isnan(res[6][2])
+    assert res[7][:1].tolist() == [1.0] and np.isnan(res[7][1]) and np.isnan(res[7][2])
+    assert res[8].tolist() == [1, 1, 0]
+
+    assert [col.tolist() for col in totals] == [[5], [2], [14], [4], [10], [7.0], [1.0], [2]]
@@ -0,0 +1,135 @@
+# Copyright 2026 Ben Walsh
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import os
+import tempfile
+import shutil
+
+import numpy as np
+
+import camog
+from camog import _cache
+
+import _testhelper as th
+
+def _cache_files(cache_dir):
+    return [f for f in os.listdir(cache_dir) if f.endswith('.camog')]
+
+
+def test_cache_roundtrip():
+    data = 'abc,def,ghi\n123,4.5,xyz\n-7,,"a,b"\n'
+
+    cache_dir = tempfile.mkdtemp()
+    try:
+        with th.TempCsvFile(data) as fname:
+            headers1, cols1 = camog.load(fname, cache_dir=cache_dir)
+            _cache.wait()
+            assert len(_cache_files(cache_dir)) == 1
+
+            headers2, cols2 = camog.load(fname, cache_dir=cache_dir)
+    finally:
+        shutil.rmtree(cache_dir)
+
+    assert headers1 == headers2 == ['abc', 'def', 'ghi']
+    assert len(cols1) == len(cols2) == 3
+    for col1, col2 in zip(cols1, cols2):
+        assert col1.dtype == col2.dtype
+        assert np.all(col1 == col2)
+    assert np.all(cols2[2] == th.array(['xyz', 'a,b']))
+
+
+def test_cache_is_mapped():
+    data = 'abc,def\n1,2\n3,4\n'
+
+    cache_dir = tempfile.mkdtemp()
+    try:
+        with th.TempCsvFile(data) as fname:
+            camog.load(fname, cache_dir=cache_dir)
+            _cache.wait()
+            _, cols = camog.load(fname, cache_dir=cache_dir)
+    finally:
+        shutil.rmtree(cache_dir)
+
+    assert not cols[0].flags.owndata
+    assert cols[0].ctypes.data % 64 == 0
+    cols[0][0] = 10  # copy-on-write
+    assert np.all(cols[0] == np.array([10, 3]))
+
+
+def test_cache_stale():
+    cache_dir = tempfile.mkdtemp()
+    try:
+        with th.TempCsvFile('abc\n1\n') as fname:
+            camog.load(fname, cache_dir=cache_dir)
+            _cache.wait()
+            with open(fname, 'w') as fp:
+                fp.write('abc\n1\n2\n')
+            _, cols = camog.load(fname, cache_dir=cache_dir)
+    finally:
+        shutil.rmtree(cache_dir)
+
+    assert np.all(cols[0] == np.array([1, 2]))
+
+
+def test_cache_options_in_key():
+    cache_dir = tempfile.mkdtemp()
+    try:
+        with th.TempCsvFile('abc;def\n1;2\n') as fname:
+            camog.load(fname, sep=';', cache_dir=cache_dir)
+            _cache.wait()
+            headers, cols = camog.load(fname, sep=';', headers=False,
+                                       cache_dir=cache_dir)
+            _cache.wait()
+            assert len(_cache_files(cache_dir)) == 2
+    finally:
+        shutil.rmtree(cache_dir)
+
+    assert headers is None
+    assert np.all(cols[0] == th.array(['abc', '1']))
+
+
+def test_cache_empty_columns():
+    cache_dir = tempfile.mkdtemp()
+    try:
+        with th.TempCsvFile('abc,def\n') as fname:
+            headers1, cols1 = camog.load(fname, cache_dir=cache_dir)
+            _cache.wait()
+            headers2, cols2 = camog.load(fname, cache_dir=cache_dir)
+    finally:
+        shutil.rmtree(cache_dir)
+
+    assert headers1 == headers2
+    assert [len(c) for c in cols1] == [len(c) for c in cols2]
+
+
+def test_cache_mutate_after_load():
+    data = 'abc,def\n1,2\n3,4\n'
+
+    cache_dir = tempfile.mkdtemp()
+    try:
+        with th.TempCsvFile(data) as fname:
+            _, cols1 = camog.load(fname, cache_dir=cache_dir)
+            try:
+                cols1[0][:] = -1
+            except ValueError:
+                pass  # read-only while the cache is written
+            _cache.wait()
+            assert cols1[0].flags.writeable
+            cols1[0][:] = -1
+            _, cols2 = camog.load(fname, cache_dir=cache_dir)
+    finally:
+        shutil.rmtree(cache_dir)
+
+    assert np.all(cols2[0] == np.array([1, 3]))
+    assert np.all(cols2[1] == np.array([2, 4]))
@@ -0,0 +1,94 @@
+# Copyright 2026 Ben Walsh
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import random
+from decimal import Decimal
+
+import numpy as np
+import pytest
+
+import camog
+
+
+def test_decimal_inferred_scale():
+    headers, cols, scales = camog.loads('px,qty,sym\n1.25,3,A\n-0.005,4,B\n12345.6,5,C\n',
+                                        decimals=['px', 'qty'])
+    assert scales == [3, 0, None]
+    assert cols[0].dtype == np.int64
+    assert list(cols[0]) == [1250, -5, 12345600]
+    assert list(cols[1]) == [3, 4, 5]
+    assert list(cols[2]) == [b'A', b'B', b'C']
+
+
+@pytest.mark.parametrize('val,scale,expected', [
+    ('0.125', 2, 13),
+    ('-0.125', 2, -13),
+    ('0.124', 2, 12),
+    ('1e-3', 2, 0),
+    ('2.5e2', 2, 25000),
+    ('7', 4, 70000),
+    ('922337203685477580.7', 1, 9223372036854775807),
+    ('0.00000000000000000012345', 18, 0),
+    ('+.5', 0, 1),
+])
+def test_decimal_scale(val, scale, expected):
+    headers, cols, scales = camog.loads('a\n%s\n' % val, decimals={0: scale})
+    assert scales == [scale]
+    assert cols[0][0] == expected
+
+
+def test_decimal_missing():
+    data = 'a,b\n1.5,x\n,y\nNA,z\nnan,w\n99999999999999999999,v\n2.25\n'
+    headers, cols, scales = camog.loads(data, decimals={'a': 2}, na_values=['NA'],
+                                        missing_int_val=-1, validity='mask')
+    assert list(cols[0].data) == [150, -1, -1, -1, -1, 225]
+    assert list(np.ma.getmaskarray(cols[0])) == [False, True, True, True, True, False]
+
+
+def test_decimal_quoted():
+    headers, cols, scales = camog.loads('a\n"1.5"\n"2.75"\n', flags=1, decimals=['a'])
+    assert scales == [2]
+    assert list(cols[0]) == [150, 275]
+
+
+@pytest.mark.parametrize('nthreads', [1, 3, 8])
+def test_decimal_exact(nthreads):
+    rng = random.Random(36)
+    vals = []
+    for _ in range(5000):
+        ndigits = rng.randint(0, 4)
+        frac = ''.join(rng.choice('0123456789') for _ in range(ndigits))
+        vals.append('%d%s' % (rng.randint(-10 ** 6, 10 ** 6), '.' + frac if frac else ''))
+    data = 'a\n' + '\n'.join(vals) + '\n'
+    headers, cols, scales = camog.loads(data, nthreads=nthreads, decimals=['a'])
+    scale = max(len(v.split('.')[1]) if '.' in v else 0 for v in vals)
+    assert scales == [scale]
+    expected = [int(Decimal(v).scaleb(scale)) for v in vals]
+    assert list(cols[0]) == expected
+
+
+def test_decimal_summary():
+    headers, cols, summary, scales = camog.loads('a\n0.125\n-0.5\n\n', decimals=['a'],
+                                                 return_summary=True)
+    assert scales == [3]
+    assert summary[0]['count'] == 2
+    assert summary[0]['nulls'] == 1
+    assert (summary[0]['min'], summary[0]['max'], summary[0]['sum']) == (-500, 125, -375)
+
+
+def test_decimal_invalid_scale():
+    with pytest.raises(ValueError):
+        camog.loads('a\n1\n', decimals={'a': 19})
+    with pytest.raises(ValueError):
+        camog.loads('a\n1\n', decimals={'a': -1})
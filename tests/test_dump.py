@@ -0,0 +1,143 @@
+# Copyright 2026 Ben Walsh
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import os
+import locale
+
+import numpy as np
+import pytest
+
+import camog
+
+
+def _columns(nrows):
+    rng = np.random.RandomState(37)
+    strs = np.array([b'abc', b'x,y', b'say "hi"', b'two\nlines', b'', b'tab\t'])
+    return [rng.randint(-2 ** 62, 2 ** 62, nrows),
+            rng.standard_normal(nrows) * 10.0 ** rng.randint(-300, 300, nrows),
+            strs[rng.randint(0, len(strs), nrows)],
+            rng.randint(-100, 100, nrows).astype(np.int8),
+            (rng.standard_normal(nrows) * 1000).astype(np.float32)]
+
+
+@pytest.mark.parametrize('nthreads', [1, 3, 8])
+def test_dump_roundtrip(tmp_path, nthreads):
+    fname = os.path.join(tmp_path, 'out.csv')
+    cols = _columns(10000)
+    camog.dump(fname, ['a', 'b', 'c', 'd', 'e'], cols, nthreads=nthreads)
+
+    headers, res = camog.load(fname, col_to_type={'d': np.int8, 'e': np.float32})
+    assert headers == ['a', 'b', 'c', 'd', 'e']
+    for col, exp in zip(res, cols):
+        assert col.dtype == exp.dtype or col.dtype.kind == exp.dtype.kind == 'S'
+        if col.dtype == np.float64:
+            # the reader can be 1ulp out with 17 digits
+            assert np.all(np.abs(col - exp) <= np.spacing(np.abs(exp)))
+        else:
+            assert np.array_equal(col, exp)
+
+
+def test_dump_same_for_any_threads(tmp_path):
+    cols = _columns(3000)
+    data = []
+    for nthreads in (1, 2, 7):
+        fname = os.path.join(tmp_path, 'out%d.csv' % nthreads)
+        camog.dump(fname, None, cols, nthreads=nthreads)
+        with open(fname, 'rb') as fh:
+            data.append(fh.read())
+    assert data[0] == data[1] == data[2]
+
+
+def test_dump_floats_exact(tmp_path):
+    fname = os.path.join(tmp_path, 'out.csv')
+    col = _columns(10000)[1]
+    camog.dump(fname, None, [col])
+    with open(fname) as fh:
+        assert all(float(line) == val for line, val in zip(fh, col))
+
+
+def test_dump_floats(tmp_path):
+    fname = os.path.join(tmp_path, 'out.csv')
+    col = np.array([0.1, 2.0, -0.0, 1e300, 5e-324, np.nan, np.inf, -np.inf, 123456789.125])
+    camog.dump(fname, ['x'], [col])
+    with open(fname) as fh:
+        lines = fh.read().splitlines()
+    assert lines[:5] == ['x', '0.1', '2.0', '-0.0', '1e+300']
+    assert float(lines[5]) == 5e-324
+    assert lines[6:] == ['nan', 'inf', '-inf', '123456789.125']
+
+
+def test_dump_floats_locale(tmp_path):
+    fname = os.path.join(tmp_path, 'out.csv')
+    old = locale.setlocale(locale.LC_NUMERIC)
+    for name in ['de_DE.UTF-8', 'de_DE.utf8', 'fr_FR.UTF-8', 'fr_FR.utf8']:
+        try:
+            locale.setlocale(locale.LC_NUMERIC, name)
+            break
+        except locale.Error:
+            pass
+    else:
+        pytest.skip('no locale with a comma decimal point')
+    try:
+        camog.dump(fname, ['x', 'y'], [np.array([0.1, 2.5e-10]), np.array([1.5, 3.0])])
+    finally:
+        locale.setlocale(locale.LC_NUMERIC, old)
+    with open(fname) as fh:
+        assert fh.read().splitlines() == ['x,y', '0.1,1.5', '2.5e-10,3.0']
+
+
+def test_dump_byteswapped(tmp_path):
+    fname = os.path.join(tmp_path, 'out.csv')
+    camog.dump(fname, ['a', 'b'], [np.array([1, 2, 300], '>i8'),
+                                   np.array([1.5, 2.25, -3.0], '>f8')])
+    with open(fname) as fh:
+        assert fh.read().splitlines() == ['a,b', '1,1.5', '2,2.25', '300,-3.0']
+
+
+def test_dump_masked(tmp_path):
+    fname = os.path.join(tmp_path, 'out.csv')
+    col = np.ma.MaskedArray(np.arange(10), mask=[i % 3 == 0 for i in range(10)])
+    camog.dump(fname, ['x', 'y'], [col, np.arange(10) > 4])
+    headers, res = camog.load(fname, validity='mask', missing_int_val=-1)
+    assert list(res[0].filled(-1)) == [-1, 1, 2, -1, 4, 5, -1, 7, 8, -1]
+    assert list(res[1]) == [0, 0, 0, 0, 0, 1, 1, 1, 1, 1]
+
+
+def test_dump_strings(tmp_path):
+    fname = os.path.join(tmp_path, 'out.csv')
+    camog.dump(fname, ['a,b', u'\xe9'], [np.array([u'x', u'y\xe9']), np.array([1, None], dtype=object)],
+               sep=',')
+    with open(fname, 'rb') as fh:
+        assert fh.read() == b'"a,b",\xc3\xa9\nx,1\ny\xc3\xa9,\n'
+
+
+def test_dump_empty(tmp_path):
+    fname = os.path.join(tmp_path, 'out.csv')
+    camog.dump(fname, ['a', 'b'], [np.zeros(0, dtype=np.int64), np.zeros(0)])
+    with open(fname) as fh:
+        assert fh.read() == 'a,b\n'
+
+
+def test_dump_errors(tmp_path):
+    fname = os.path.join(tmp_path, 'out.csv')
+    with pytest.raises(ValueError):
+        camog.dump(fname, ['a', 'b'], [np.arange(3), np.arange(4)])
+    with pytest.raises(ValueError):
+        camog.dump(fname, ['a'], [np.arange(3), np.arange(3)])
+    with pytest.raises(TypeError):
+        camog.dump(fname, ['a'], [np.array([2 ** 63], dtype=np.uint64)])
+    with pytest.raises(IOError):
+        camog.dump(os.path.join(tmp_path, 'nosuch', 'out.csv'), ['a'], [np.arange(3)])
+    with pytest.raises(ValueError):
+        camog._cfastcsv.write_file(fname, [np.arange(3, dtype='>i8')], None, [None])
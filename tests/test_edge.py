@@ -14,6 +14,7 @@
 
 import numpy as np
 
+import camog
 import camog._cfastcsv as cfastcsv
 
 import _testhelper as th
@@ -113,3 +114,41 @@ def test_hard_end_empty_cell():
     res = _do_parse_csv(csv_str)
 
     assert len(res) == 3
+
+
+def test_long_quoted():
+    # quotes and CRs either side of the 32 byte blocks, and at the very end
+    rng = np.random.RandomState(44)
+    cells = []
+    for i in range(400):
+        chars = rng.choice(list('abc,\n\r"'), size=rng.randint(0, 100),
+                           p=[0.3, 0.3, 0.25, 0.05, 0.04, 0.03, 0.03])
+        cells.append(''.join(chars))
+    csv_str = ''.join('"%s",%d\n' % (cell.replace('"', '""'), i) for i, cell in enumerate(cells))
+    exp = [cell.replace('\r', '').encode() for cell in cells]
+
+    for nthreads in (1, 3):
+        res = _do_parse_csv(csv_str, nthreads=nthreads)
+        assert list(res[0]) == exp
+        assert list(res[1]) == list(range(len(cells)))
+
+    res = _do_parse_csv(csv_str[:-3])
+    assert res[0][-1] == exp[-1]
+
+
+def test_long_unquoted():
+    # string cells copied 16 bytes at a time, up to the end of each chunk
+    rng = np.random.RandomState(45)
+    cells = [''.join(rng.choice(list('abcx\r'), size=rng.randint(0, 60), p=[0.3, 0.3, 0.2, 0.18, 0.02]))
+             for i in range(500)]
+    csv_str = ''.join('%s,%s,%d\r\n' % (cell, cell[:3], i) for i, cell in enumerate(cells))
+    exp = [cell.replace('\r', '').encode() for cell in cells]
+
+    for nthreads in (1, 3, 7):
+        res = _do_parse_csv(csv_str, nthreads=nthreads)
+        assert list(res[0]) == exp
+        assert list(res[1]) == [cell[:3].replace('\r', '').encode() for cell in cells]
+        assert list(res[2]) == list(range(len(cells)))
+
+    res = camog.loads(csv_str, headers=False, nthreads=3, filter=('==', 2, 7))[1]
+    assert list(res[0]) == [exp[7]]
@@ -0,0 +1,122 @@
+# Copyright 2026 Ben Walsh
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import numpy as np
+import pytest
+
+import camog
+
+import _testhelper as th
+
+def _data(nrows):
+    syms = ['AAA', 'BB', '"C,C"', 'DDDD']
+    return 'date,sym,px\n' + ''.join('%d,%s,%s\n' % (20200101 + i % 50, syms[i % 4],
+                                                       '' if i % 7 == 0 else '%d.5' % i)
+                                     for i in range(nrows))
+
+
+def _check_mask(data, spec, mask_func, nthreads=3):
+    headers, cols = camog.loads(data, nthreads=nthreads)
+    fheaders, fcols = camog.loads(data, nthreads=nthreads, filter=spec)
+    mask = mask_func(cols)
+
+    assert fheaders == headers
+    assert len(fcols) == len(cols)
+    for col, fcol in zip(cols, fcols):
+        assert fcol.dtype == col.dtype
+        assert np.array_equal(fcol, col[mask])
+
+
+@pytest.mark.parametrize('nthreads', [1, 3, 8])
+def test_filter_compare(nthreads):
+    data = _data(1000)
+    _check_mask(data, ('>=', 'date', 20200140), lambda c: c[0] >= 20200140, nthreads)
+    _check_mask(data, ('<', 0, 20200103), lambda c: c[0] < 20200103, nthreads)
+    _check_mask(data, ('==', 'sym', 'C,C'), lambda c: c[1] == b'C,C', nthreads)
+    _check_mask(data, ('!=', 'sym', b'BB'), lambda c: c[1] != b'BB', nthreads)
+    _check_mask(data, ('>', 'px', 500), lambda c: c[2] > 500, nthreads)
+    _check_mask(data, ('<=', 'sym', 'BB'), lambda c: c[1] <= b'BB', nthreads)
+
+
+def test_filter_combined():
+    data = _data(1000)
+    _check_mask(data, ('and', ('between', 'date', 20200110, 20200120),
+                       ('in', 'sym', ['AAA', 'DDDD'])),
+                lambda c: ((c[0] >= 20200110) & (c[0] <= 20200120)
+                           & ((c[1] == b'AAA') | (c[1] == b'DDDD'))))
+    _check_mask(data, ('or', ('==', 'date', 20200101), ('>=', 'px', 990.0)),
+                lambda c: (c[0] == 20200101) | (c[2] >= 990.0))
+    _check_mask(data, ('in', 'date', [20200105, 20200107.0]),
+                lambda c: (c[0] == 20200105) | (c[0] == 20200107))
+
+
+def test_filter_missing_values():
+    # missing cells compare as the missing value they are loaded as
+    data = 'a,b\n1,2.5\n2\n,3.5\n4,\n'
+    _check_mask(data, ('==', 'a', 0), lambda c: c[0] == 0)
+    _check_mask(data, ('!=', 'b', 0.0), lambda c: c[1] != 0.0)
+
+    headers, cols = camog.loads(data, filter=('>', 'b', 1.0), missing_float_val=np.nan)
+    assert np.all(cols[0] == np.array([1, 0]))
+    headers, cols = camog.loads(data, filter=('!=', 'b', 1.0), missing_float_val=np.nan)
+    assert len(cols[0]) == 4  # nan != 1.0
+
+
+def test_filter_quoted_newlines():
+    data = 'abc,def\n' + ''.join('%d,"x\n%d"\n' % (i, i) for i in range(200))
+    _check_mask(data, ('>=', 'abc', 150), lambda c: c[0] >= 150, nthreads=4)
+    _check_mask(data, ('==', 'def', 'x\n7'), lambda c: c[1] == b'x\n7', nthreads=4)
+
+
+def test_filter_none_kept():
+    headers, cols = camog.loads(_data(100), filter=('>', 'date', 30000000))
+    assert headers == ['date', 'sym', 'px']
+    assert [len(c) for c in cols] == [0, 0, 0]
+
+
+def test_filter_empty():
+    headers, cols = camog.loads('abc\n', filter=('==', 'abc', 1))
+    assert headers == ['abc']
+
+
+def test_filter_errors():
+    data = _data(10)
+    with pytest.raises(ValueError):
+        camog.loads(data, filter=('==', 'nosuch', 1))
+    with pytest.raises(ValueError):
+        camog.loads(data, filter=('==', 5, 1))
+    with pytest.raises(ValueError):
+        camog.loads(data, filter=('like', 'sym', 'A'))
+    with pytest.raises(ValueError):
+        camog.loads(data, headers=False, filter=('==', 'date', 1))
+    with pytest.raises(TypeError):
+        camog.loads(data, filter=('==', 'date', '20200101'))
+    with pytest.raises(TypeError):
+        camog.loads(data, filter=('==', 'sym', 1))
+
+
+def test_filter_load():
+    data = _data(300)
+    with th.TempCsvFile(data) as fname:
+        headers, cols = camog.load(fname, filter=('in', 'sym', ['BB']))
+    assert np.all(cols[1] == b'BB')
+    assert len(cols[0]) == 75
+
+
+def test_filter_stats():
+    headers, cols, stats = camog.loads(_data(100), filter=('==', 'sym', 'BB'),
+                                       return_stats=True)
+    assert len(cols[0]) == 25
+    assert stats['allocate_begin'] <= stats['filter_begin'] <= stats['filter_end']
+    assert stats['filter_end'] <= stats['allocate_end']
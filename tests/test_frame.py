@@ -0,0 +1,106 @@
+# Copyright 2026 Ben Walsh
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+
+import os
+
+import numpy as np
+import pytest
+
+import camog
+
+pd = pytest.importorskip('pandas')
+
+
+def _write(tmp_path, data):
+    fname = os.path.join(tmp_path, 'in.csv')
+    with open(fname, 'w') as fh:
+        fh.write(data)
+    return fname
+
+
+def test_read_frame(tmp_path):
+    fname = _write(tmp_path, 'a,b,c,d,e\n1,2.5,x,3,y\n4,,z\xe9,5,w\n7,8.25,,9,v\n')
+    df = camog.read_frame(fname)
+    assert list(df.columns) == ['a', 'b', 'c', 'd', 'e']
+    assert list(df.index) == [0, 1, 2]
+    assert [df[c].dtype.kind for c in df.columns] == ['i', 'f', 'O', 'i', 'O']
+    assert list(df['a']) == [1, 4, 7]
+    assert list(df['b']) == [2.5, 0.0, 8.25]
+    assert list(df['c']) == ['x', u'z\xe9', '']
+    assert list(df['d']) == [3, 5, 9]
+    assert list(df['e']) == ['y', 'w', 'v']
+
+
+@pytest.mark.parametrize('nthreads', [1, 4])
+def test_read_frame_blocks(tmp_path, nthreads):
+    rng = np.random.RandomState(39)
+    nrows = 20000
+    ints = rng.randint(-1000, 1000, (3, nrows))
+    floats = rng.randint(-1000, 1000, (2, nrows)) / 8.0
+    lines = ['i0,f0,i1,f1,i2']
+    lines += ['%d,%.3f,%d,%.3f,%d' % (ints[0, r], floats[0, r], ints[1, r], floats[1, r], ints[2, r])
+              for r in range(nrows)]
+    fname = _write(tmp_path, '\n'.join(lines) + '\n')
+
+    df = camog.read_frame(fname, nthreads=nthreads)
+    for i in range(3):
+        assert np.array_equal(df['i%d' % i].values, ints[i])
+    for i in range(2):
+        assert np.array_equal(df['f%d' % i].values, floats[i])
+    if hasattr(pd.api, 'internals'):
+        assert len(df._mgr.blocks) == 2
+
+
+def test_read_frame_no_block_api(tmp_path, monkeypatch):
+    if hasattr(pd.api, 'internals'):
+        monkeypatch.delattr(pd.api.internals, 'create_dataframe_from_blocks')
+    fname = _write(tmp_path, 'a,b,c\n1,2.5,3\n4,5.5,6\n')
+    df = camog.read_frame(fname)
+    assert list(df['a']) == [1, 4]
+    assert list(df['b']) == [2.5, 5.5]
+    assert list(df['c']) == [3, 6]
+
+
+def test_parse_blocks(tmp_path):
+    fname = _write(tmp_path, 'a,b,c,d\n1,2.5,3,x\n4,5.5,6,y\n')
+    headers, cols = camog._cfastcsv.parse_file(fname, ',', 2, 0, 1, 0, 0.0, None, blocks=True)
+    assert cols[0].base is cols[2].base
+    assert cols[0].base.shape == (2, 2)
+    assert list(cols[0].base[1]) == [3, 6]
+    assert cols[1].base.shape == (1, 2)
+    assert cols[3].base is None
+
+
+def test_read_frame_no_headers(tmp_path):
+    fname = _write(tmp_path, '1,2\n3,4\n')
+    df = camog.read_frame(fname, headers=False)
+    assert list(df.columns) == [0, 1]
+    assert list(df[1]) == [2, 4]
+
+
+def test_read_frame_options(tmp_path):
+    fname = _write(tmp_path, 'a,a,b\n1,NA,x\n2,3.5,y\n')
+    df = camog.read_frame(fname, na_values=['NA'], missing_float_val=-1.0, narrow='int_only',
+                          filter=('!=', 'b', 'y'))
+    assert len(df) == 1
+    assert list(df.columns) == ['a', 'a', 'b']
+    assert df.iloc[0, 0] == 1 and df.iloc[0, 0].dtype == np.int8
+    assert df.iloc[0, 1] == -1.0
+
+
+def test_read_frame_empty(tmp_path):
+    fname = _write(tmp_path, 'a,b\n')
+    df = camog.read_frame(fname)
+    assert len(df) == 0
@@ -0,0 +1,111 @@
+# Copyright 2026 Ben Walsh
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+
+import os
+import random
+
+import numpy as np
+import pytest
+
+import camog
+
+
+def _write(tmp_path, data):
+    fname = os.path.join(tmp_path, 'in.csv')
+    with open(fname, 'w') as fh:
+        fh.write(data)
+    return fname
+
+
+def _quoted_csv(nrows):
+    rng = random.Random(41)
+    rows = []
+    for i in range(nrows):
+        rows.append('%d,%s,%s' % (i, rng.choice(['"a,""b""\nc"', 'x', '']),
+                                  rng.choice(['1.5', '', '-2e3'])))
+    return 'id,s,f\n' + '\r\n'.join(rows) + '\n'
+
+
+KWARGS = {'col_to_type': {'s': str, 'f': float}}
+
+
+@pytest.mark.parametrize('rows', [slice(0, 10), slice(5, 6), slice(100, 2000), slice(-3, None),
+                                  slice(10, 5), slice(None), slice(2990, 4000)])
+def test_load_rows(tmp_path, rows):
+    fname = _write(tmp_path, _quoted_csv(3000))
+    camog.build_index(fname, step=7)
+    headers, cols = camog.load(fname, **KWARGS)
+    headers2, cols2 = camog.load(fname, rows=rows, nthreads=3, **KWARGS)
+    assert headers2 == headers
+    for col, col2 in zip(cols, cols2):
+        assert np.array_equal(col2, col[rows])
+
+
+@pytest.mark.parametrize('nthreads', [1, 4])
+def test_take(tmp_path, nthreads):
+    fname = _write(tmp_path, _quoted_csv(3000))
+    headers, cols = camog.load(fname, **KWARGS)
+    row_ids = np.random.RandomState(41).randint(-3000, 3000, 500)
+    headers2, cols2 = camog.take(fname, row_ids, nthreads=nthreads, **KWARGS)
+    assert headers2 == headers
+    for col, col2 in zip(cols, cols2):
+        assert np.array_equal(col2, col[row_ids])
+    assert os.path.exists(fname + '.camogidx')
+
+    with pytest.raises(IndexError):
+        camog.take(fname, [3000])
+
+
+def test_index_rebuilt(tmp_path):
+    fname = _write(tmp_path, 'a,b\n1,2\n3,4\n')
+    camog.build_index(fname)
+    assert list(camog.take(fname, [1])[1][0]) == [3]
+    with open(fname, 'a') as fh:
+        fh.write('5,6\n')
+    assert list(camog.load(fname, rows=slice(-1, None))[1][1]) == [6]
+    assert list(camog.take(fname, [0, 2], sep=';')[1][0]) == [b'1,2', b'5,6']
+
+
+def test_take_no_headers(tmp_path):
+    fname = _write(tmp_path, '1,x\n2,y\n3,z\n')
+    headers, cols = camog.take(fname, [2, 0], headers=False, col_to_type={1: str})
+    assert headers is None
+    assert list(cols[0]) == [3, 1]
+    assert list(cols[1]) == [b'z', b'x']
+
+
+def test_take_mask(tmp_path):
+    fname = _write(tmp_path, 'a\n1\nNA\n3\n')
+    headers, cols = camog.take(fname, [1, 2], na_values=['NA'], validity='mask')
+    assert list(cols[0].filled(-1)) == [-1, 3]
+
+
+def test_take_empty(tmp_path):
+    fname = _write(tmp_path, 'a,b\n')
+    headers, cols = camog.take(fname, [])
+    assert headers == ['a', 'b']
+    assert all(len(col) == 0 for col in cols)
+    headers, cols = camog.load(fname, rows=slice(0, 5))
+    assert all(len(col) == 0 for col in cols)
+
+
+def test_rows_errors(tmp_path):
+    fname = _write(tmp_path, 'a\n1\n')
+    with pytest.raises(ValueError):
+        camog.load(fname, rows=slice(0, 1), filter=('==', 'a', 1))
+    with pytest.raises(ValueError):
+        camog.load(fname, rows=slice(0, 1, 2))
+    with pytest.raises(ValueError):
+        camog.build_index(fname, step=0)
@@ -0,0 +1,73 @@
+# Copyright 2026 Ben Walsh
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+
+import numpy as np
+import pytest
+
+import camog
+
+# NA tokens that never match make load use the generic fill_arrays.
+_GENERIC = {'na_values': ['zzz']}
+
+
+def _cells(rng, kind, nrows):
+    if kind == 'i':
+        vals = ['%d' % v for v in rng.randint(-10 ** 12, 10 ** 12, nrows)]
+    else:
+        vals = ['%.*g' % (int(d), v) for d, v in zip(rng.randint(1, 18, nrows),
+                                                 rng.standard_normal(nrows) * 10.0 ** rng.randint(-20, 20, nrows))]
+    specials = ['', ' 7 ', '-0', '+5']
+    if kind == 'd':
+        specials += ['nan', '-inf', '1e5', '.5']
+    for i in rng.randint(0, nrows, nrows // 10):
+        vals[i] = specials[rng.randint(0, len(specials))]
+    return vals
+
+
+def _csv(types, nrows, seed, newline='\n'):
+    rng = np.random.RandomState(seed)
+    cols = [_cells(rng, t, nrows) for t in types]
+    lines = []
+    for row_idx in range(nrows):
+        cells = [col[row_idx] for col in cols]
+        if rng.randint(0, 20) == 0:
+            cells = cells[:rng.randint(1, len(cells) + 1)]  # short row
+        lines.append(','.join(cells))
+    return (newline.join(lines) + newline).encode('utf8')
+
+
+def _check(s, **kwargs):
+    _, fast = camog.loads(s, headers=False, nthreads=3, **kwargs)
+    kwargs.update(_GENERIC)
+    _, generic = camog.loads(s, headers=False, nthreads=3, **kwargs)
+    assert len(fast) == len(generic)
+    for x, y in zip(fast, generic):
+        assert x.dtype == y.dtype
+        assert np.array_equal(x, y, equal_nan=(x.dtype.kind == 'f'))
+    return fast
+
+
+@pytest.mark.parametrize('types', ['i', 'd', 'iiii', 'dddd', 'idid', 'didi', 'ididi', 'idd'])
+@pytest.mark.parametrize('newline', ['\n', '\r\n'])
+def test_kernels_match_generic(types, newline):
+    res = _check(_csv(types, 2000, len(types), newline), missing_int_val=-1, missing_float_val=-1.5)
+    assert [col.dtype.kind for col in res] == ['i' if t == 'i' else 'f' for t in types]
+
+
+def test_kernel_bad_cells():
+    s = b'1,2.5\n"3x",4\n5,6y\n,\n7,"8"\n"",""\n9'
+    res = _check(s, col_to_type={0: np.int64, 1: np.float64})
+    assert list(res[0]) == [1, 0, 5, 0, 7, 0, 9]
+    assert list(res[1]) == [2.5, 4.0, 0.0, 0.0, 8.0, 0.0, 0.0]
@@ -0,0 +1,143 @@
+# Copyright 2026 Ben Walsh
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import os
+import tempfile
+import shutil
+import pytest
+
+import numpy as np
+
+import camog
+
+import _testhelper as th
+
+class TempCsvFiles(object):
+    def __init__(self, datas):
+        self._datas = datas
+
+    def __enter__(self):
+        self._dirname = tempfile.mkdtemp()
+        fnames = []
+        for i, data in enumerate(self._datas):
+            fname = os.path.join(self._dirname, 'part%03d.csv' % i)
+            with open(fname, 'wb') as fp:
+                fp.write(th.string(data))
+            fnames.append(fname)
+        return fnames
+
+    def __exit__(self, exc_type, exc_val, exc_tb):
+        shutil.rmtree(self._dirname)
+
+
+def test_load_many():
+    datas = ['a,b\n1,2\n3,4\n', 'a,b\n5,6\n', 'a,b\n7,8\n9,10\n11,12\n']
+
+    with TempCsvFiles(datas) as fnames:
+        headers, cols = camog.load_many(fnames, nthreads=4)
+
+    assert headers == ['a', 'b']
+    assert np.all(cols[0] == np.array([1, 3, 5, 7, 9, 11]))
+    assert np.all(cols[1] == np.array([2, 4, 6, 8, 10, 12]))
+
+
+def test_load_many_glob():
+    datas = ['a\n1\n', 'a\n2\n', 'a\n3\n']
+
+    with TempCsvFiles(datas) as fnames:
+        headers, cols = camog.load_many(os.path.join(os.path.dirname(fnames[0]), '*.csv'))
+
+    assert headers == ['a']
+    assert np.all(cols[0] == np.array([1, 2, 3]))
+
+
+def test_load_many_supertype():
+    datas = ['a,b,c\n1,2,3\n', 'a,b,c\n1.5,x,4\n', 'a,b,c\n2,3\n']
+
+    with TempCsvFiles(datas) as fnames:
+        headers, cols = camog.load_many(fnames, nthreads=2)
+
+    assert headers == ['a', 'b', 'c']
+    assert cols[0].dtype.kind == 'f'
+    assert np.all(cols[0] == np.array([1.0, 1.5, 2.0]))
+    assert np.all(cols[1] == th.array(['2', 'x', '3']))
+    assert cols[2].dtype.kind == 'i'
+    assert np.all(cols[2] == np.array([3, 4, 0]))
+
+
+def test_load_many_extra_columns():
+    datas = ['1,2\n', '3,4,5\n', '6\n']
+
+    with TempCsvFiles(datas) as fnames:
+        headers, cols = camog.load_many(fnames, headers=False)
+
+    assert headers is None
+    assert len(cols) == 3
+    assert np.all(cols[0] == np.array([1, 3, 6]))
+    assert np.all(cols[1] == np.array([2, 4, 0]))
+    assert np.all(cols[2] == np.array([0, 5, 0]))
+
+
+def test_load_many_no_final_newline():
+    datas = ['a,b\n1,2', 'a,b\n3,4', 'a,b\n"5\n",6']
+
+    with TempCsvFiles(datas) as fnames:
+        headers, cols = camog.load_many(fnames, nthreads=3)
+
+    assert np.all(cols[0] == th.array(['1', '3', '5\n']))
+    assert np.all(cols[1] == np.array([2, 4, 6]))
+
+
+def test_load_many_quoted_fixup():
+    rows = ['"%s\n,%d",%d' % ('x' * (i % 7), i, i) for i in range(200)]
+    datas = ['a,b\n' + '\n'.join(rows[:120]) + '\n', 'a,b\n' + '\n'.join(rows[120:]) + '\n']
+
+    with TempCsvFiles(datas) as fnames:
+        _, cols = camog.load_many(fnames, nthreads=7)
+
+    _, expected = camog.loads('a,b\n' + '\n'.join(rows) + '\n', nthreads=1)
+    assert np.all(cols[0] == expected[0])
+    assert np.all(cols[1] == expected[1])
+
+
+def test_load_many_empty():
+    with pytest.raises(ValueError):
+        camog.load_many([])
+
+
+def test_load_many_headers_differ():
+    datas = ['a,b\n1,2\n', 'a,b\r\n3,4\r\n', 'a,c\n5,6\n']
+
+    with TempCsvFiles(datas[:2]) as fnames:
+        headers, cols = camog.load_many(fnames)
+    assert headers == ['a', 'b']
+
+    with TempCsvFiles(datas) as fnames:
+        with pytest.raises(ValueError, match='header'):
+            camog.load_many(fnames)
+
+
+def test_load_many_fd_limit():
+    resource = pytest.importorskip('resource')
+    datas = ['a\n%d\n' % i for i in range(200)]
+
+    with TempCsvFiles(datas) as fnames:
+        soft, hard = resource.getrlimit(resource.RLIMIT_NOFILE)
+        resource.setrlimit(resource.RLIMIT_NOFILE, (min(64, soft), hard))
+        try:
+            _, cols = camog.load_many(fnames, nthreads=3)
+        finally:
+            resource.setrlimit(resource.RLIMIT_NOFILE, (soft, hard))
+
+    assert np.all(cols[0] == np.arange(200))
@@ -0,0 +1,135 @@
+# Copyright 2026 Ben Walsh
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import numpy as np
+import pytest
+
+import camog
+
+import _testhelper as th
+
+NA_VALUES = ['NA', 'null', '\\N']
+
+
+def _data(nrows):
+    lines = ['i,f,s']
+    valid = []
+    for row in range(nrows):
+        i = [str(row), 'NA', '', 'null'][row % 4 if row % 3 == 0 else 0]
+        f = '\\N' if row % 7 == 0 else '%d.5' % row
+        s = '"null"' if row % 5 == 0 else 'x%d' % (row % 9)
+        lines.append('%s,%s,%s' % (i, f, s))
+        valid.append((i == str(row), row % 7 != 0, row % 5 != 0))
+    return '\n'.join(lines) + '\n', np.array(valid)
+
+
+def _unpack(bitmap, nrows):
+    return np.unpackbits(bitmap[:, None], axis=1)[:, ::-1].ravel()[:nrows] == 1
+
+
+@pytest.mark.parametrize('nthreads', [1, 3, 8])
+def test_na_bitmap(nthreads):
+    nrows = 1000
+    data, valid = _data(nrows)
+    headers, cols, bitmaps = camog.loads(data, nthreads=nthreads, na_values=NA_VALUES,
+                                         validity='bitmap')
+
+    assert cols[0].dtype == np.int64
+    assert cols[1].dtype == np.float64
+    assert cols[2].dtype.kind == 'S'
+    for col_idx in range(3):
+        assert len(bitmaps[col_idx]) == (nrows + 7) // 8
+        assert np.array_equal(_unpack(bitmaps[col_idx], nrows), valid[:, col_idx])
+    assert (cols[0][~valid[:, 0]] == 0).all()
+    assert (cols[2][~valid[:, 2]] == b'').all()
+
+
+def test_na_mask():
+    data, valid = _data(100)
+    headers, cols = camog.loads(data, na_values=NA_VALUES, validity='mask')
+    for col_idx in range(3):
+        assert isinstance(cols[col_idx], np.ma.MaskedArray)
+        assert np.array_equal(cols[col_idx].mask, ~valid[:, col_idx])
+    assert cols[0].sum() == sum(row for row in range(100) if valid[row, 0])
+
+
+def test_na_without_tokens():
+    headers, cols = camog.loads('a,b\n1,NA\n2,3\n')
+    assert cols[1].dtype.kind == 'S'
+
+
+def test_na_keeps_type():
+    headers, cols = camog.loads('a,b\n1,.\n2,3\n', na_values=['.'])
+    assert cols[1].dtype == np.int64
+    assert list(cols[1]) == [0, 3]
+
+
+def test_na_number_token():
+    headers, cols = camog.loads('a\n1\n-999\n3\n', na_values=['-999'], validity='mask')
+    assert list(cols[0].mask) == [False, True, False]
+    assert cols[0].sum() == 4
+
+
+def test_na_quoted():
+    headers, cols, bitmaps = camog.loads('a,b\n"NA",1\n2,"NA"\n', na_values=['NA'],
+                                         validity='bitmap')
+    assert list(cols[0]) == [0, 2]
+    assert list(_unpack(bitmaps[0], 2)) == [False, True]
+    assert list(_unpack(bitmaps[1], 2)) == [True, False]
+
+
+def test_validity_no_nulls():
+    headers, cols, bitmaps = camog.loads('a,b\n1,x\n2,y\n', validity='bitmap')
+    assert bitmaps == [None, None]
+
+
+def test_validity_short_rows():
+    headers, cols, bitmaps = camog.loads('a,b,c\n1,2,3\n4\n5,6,', validity='bitmap')
+    assert bitmaps[0] is None
+    assert list(_unpack(bitmaps[1], 3)) == [True, False, True]
+    assert list(_unpack(bitmaps[2], 3)) == [True, False, False]
+    assert list(cols[2]) == [3, 0, 0]
+
+
+def test_validity_filter():
+    data = 'a,b\n' + ''.join('%d,%s\n' % (i, 'NA' if i % 3 == 0 else str(i)) for i in range(50))
+    headers, cols = camog.loads(data, nthreads=4, na_values=['NA'], validity='mask',
+                                filter=('>=', 'a', 20))
+    assert list(cols[0]) == list(range(20, 50))
+    assert list(cols[1].mask) == [i % 3 == 0 for i in range(20, 50)]
+
+
+def test_na_filter_and_aggregate():
+    data = 'k,v\nNA,1\nx,NA\nx,2\n'
+    headers, cols = camog.loads(data, na_values=['NA'], filter=('==', 'k', ''))
+    assert list(cols[1]) == [1]
+    with th.TempCsvFile(data) as fname:
+        headers, cols = camog.aggregate(fname, group_by='k', aggs=[('sum', 'v')],
+                                        na_values=['NA'])
+    assert list(cols[0]) == [b'', b'x']
+    assert list(cols[1]) == [1, 2]
+
+
+def test_na_load_many():
+    with th.TempCsvFile('a\n1\nNA\n') as fname1:
+        with th.TempCsvFile('a\nNA\n4\n') as fname2:
+            headers, cols = camog.load_many([fname1, fname2], na_values=['NA'],
+                                            validity='mask')
+    assert cols[0].dtype == np.int64
+    assert list(cols[0].mask) == [False, True, True, False]
+
+
+def test_invalid_validity():
+    with pytest.raises(ValueError):
+        camog.loads('a\n1\n', validity='bits')
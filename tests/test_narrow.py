@@ -0,0 +1,124 @@
+# Copyright 2026 Ben Walsh
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import random
+
+import numpy as np
+import pytest
+
+import camog
+
+
+@pytest.mark.parametrize('vals,dtype', [
+    (['-9', '99', '0'], np.int8),
+    (['-99', '5'], np.int16),
+    (['-999', '9999'], np.int16),
+    (['10000', '-1'], np.int32),
+    (['999999999', '-99999999'], np.int32),
+    (['1000000000'], np.int64),
+    (['-9223372036854775808', '1'], np.int64),
+])
+def test_narrow_int(vals, dtype):
+    headers, cols = camog.loads('a\n' + '\n'.join(vals) + '\n', narrow='int_only')
+    assert cols[0].dtype == dtype
+    assert list(cols[0]) == [int(v) for v in vals]
+
+
+def test_narrow_off():
+    headers, cols = camog.loads('a,b\n1,1.5\n')
+    assert cols[0].dtype == np.int64
+    assert cols[1].dtype == np.float64
+
+
+def test_narrow_int_only_keeps_floats():
+    headers, cols = camog.loads('a,b\n1,1.5\n', narrow='int_only')
+    assert cols[0].dtype == np.int8
+    assert cols[1].dtype == np.float64
+
+
+@pytest.mark.parametrize('vals,dtype', [
+    (['1.5', '-2.25', 'nan', '-inf'], np.float32),
+    (['123.456', '1234567', '.000001'], np.float32),
+    (['1234.567'], np.float64),
+    (['1e5', '2'], np.float64),
+    (['1.5', '3E2'], np.float64),
+])
+def test_narrow_float(vals, dtype):
+    headers, cols = camog.loads('a\n' + '\n'.join(vals) + '\n', narrow='auto')
+    assert cols[0].dtype == dtype
+    expected = np.array([float(v) for v in vals], dtype=dtype)
+    assert np.array_equal(cols[0], expected, equal_nan=True)
+
+
+def test_narrow_missing_value():
+    data = 'a\n1\n\n2\n'
+    headers, cols = camog.loads(data, narrow='int_only', missing_int_val=-1)
+    assert cols[0].dtype == np.int8
+    assert list(cols[0]) == [1, -1, 2]
+    headers, cols = camog.loads(data, narrow='int_only', missing_int_val=-100000)
+    assert cols[0].dtype == np.int32
+
+
+@pytest.mark.parametrize('nthreads', [1, 3, 8])
+def test_narrow_chunks(nthreads):
+    vals = [str(i % 200 - 100) for i in range(1000)]
+    vals[777] = '123456'  # widens every chunk
+    headers, cols = camog.loads('a\n' + '\n'.join(vals) + '\n', nthreads=nthreads,
+                                narrow='auto')
+    assert cols[0].dtype == np.int32
+    assert list(cols[0]) == [int(v) for v in vals]
+
+
+def test_float32_rounding():
+    rng = random.Random(42)
+    vals = []
+    for i in range(20000):
+        digits = rng.randint(1, 12)
+        mantissa = str(rng.randint(0, 10 ** digits - 1))
+        point = rng.randint(0, len(mantissa))
+        val = mantissa[:point] + '.' + mantissa[point:]
+        if i % 5 == 0:
+            val += 'e%d' % rng.randint(-40, 30)
+        vals.append(('-' if i % 3 == 0 else '') + val)
+    headers, cols = camog.loads('a\n' + '\n'.join(vals) + '\n', nthreads=4,
+                                col_to_type={'a': np.float32})
+    expected = np.array(vals, dtype=np.float32)
+    short = np.array([len(v.lstrip('-').replace('.', '').lstrip('0')) <= 7 and 'e' not in v
+                      for v in vals])
+    assert cols[0].dtype == np.float32
+    assert np.array_equal(cols[0][short], expected[short])
+    assert np.allclose(cols[0], expected, rtol=1e-7, atol=0)
+
+
+def test_col_to_type_numpy():
+    data = 'a,b,c,d\n1,2,3,4.5\n'
+    headers, cols = camog.loads(data, col_to_type={'a': np.int16, 'b': 'f4', 'c': np.float64,
+                                                   3: np.int32})
+    assert [col.dtype for col in cols] == [np.int16, np.float32, np.float64, np.int32]
+    assert list(cols[3]) == [0]
+
+
+def test_narrow_summary_and_filter():
+    data = 'a,b\n' + ''.join('%d,%d.5\n' % (i % 50, i) for i in range(300))
+    headers, cols, summary = camog.loads(data, narrow='auto', nthreads=3,
+                                         filter=('<', 'a', 10), return_summary=True)
+    assert cols[0].dtype == np.int8
+    assert cols[1].dtype == np.float32
+    assert summary[0]['max'] == 9
+    assert summary[1]['count'] == 60
+
+
+def test_invalid_narrow():
+    with pytest.raises(ValueError):
+        camog.loads('a\n1\n', narrow='yes')
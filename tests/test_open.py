@@ -0,0 +1,91 @@
+# Copyright 2026 Ben Walsh
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+
+import os
+import random
+
+import numpy as np
+import pytest
+
+import camog
+
+
+def _write(tmp_path, data):
+    fname = os.path.join(tmp_path, 'in.csv')
+    with open(fname, 'w') as fh:
+        fh.write(data)
+    return fname
+
+
+def _ragged_csv():
+    rng = random.Random(40)
+    rows = []
+    for _ in range(3000):
+        cells = [str(rng.randint(-100, 100)),
+                 rng.choice(['%.3f' % rng.uniform(-1e3, 1e3), '', 'NA', '1e5']),
+                 rng.choice(['abc', '"q,""x""\nline"', '', 'NA']),
+                 rng.choice(['"12"', '7', '']),
+                 str(rng.randint(0, 10 ** 12))]
+        rows.append(','.join(cells[:rng.randint(1, 5)]))
+    return 'a,b,c,d,e\n' + '\r\n'.join(rows) + '\n'
+
+
+@pytest.mark.parametrize('nthreads', [1, 3, 8])
+@pytest.mark.parametrize('kwargs', [
+    {},
+    {'na_values': ['NA'], 'narrow': 'auto', 'missing_int_val': -1, 'missing_float_val': -2.0},
+    {'col_to_type': {'e': np.int32, 'a': str}},
+    {'flags': 1},
+])
+def test_open_same_as_load(tmp_path, nthreads, kwargs):
+    fname = _write(tmp_path, _ragged_csv())
+    headers, cols = camog.load(fname, nthreads=nthreads, **kwargs)
+    table = camog.open(fname, nthreads=nthreads, **kwargs)
+    assert table.headers == headers
+    assert len(table) == len(cols[0])
+    for i in reversed(range(len(cols))):
+        assert table[i].dtype == cols[i].dtype
+        assert np.array_equal(table[i], cols[i])
+
+
+def test_open_cached(tmp_path):
+    fname = _write(tmp_path, 'a,b,c\n1,x,3\n2,y,4\n')
+    with camog.open(fname) as table:
+        a = table['a']
+        assert table[0] is a
+        assert list(table['b']) == [b'x', b'y']
+        assert list(table[-2]) == [b'x', b'y']
+    assert table['a'] is a
+    with pytest.raises(ValueError):
+        table['c']
+
+
+def test_open_missing_columns(tmp_path):
+    fname = _write(tmp_path, '1,2\n3\n')
+    table = camog.open(fname, headers=False)
+    assert table.headers is None
+    assert list(table[1]) == [2, 0]
+    with pytest.raises(IndexError):
+        table[2]
+    with pytest.raises(KeyError):
+        table['a']
+
+
+def test_open_no_rows(tmp_path):
+    fname = _write(tmp_path, 'a,b\n')
+    table = camog.open(fname)
+    assert table.headers == ['a', 'b']
+    assert len(table) == 0
+    assert len(table['a']) == 0
@@ -0,0 +1,73 @@
+# Copyright 2026 Ben Walsh
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+
+import numpy as np
+import pytest
+
+import camog
+
+import _testhelper as th
+
+def test_out():
+    data = 'a,b,c\n1,2.5,x\n3,4.5,yy\n'
+    out = [np.zeros(10, np.int64), np.zeros(10), np.zeros(10, 'S4')]
+
+    headers, cols = camog.loads(data, schema=[int, float, 'S4'], out=out)
+
+    assert headers == ['a', 'b', 'c']
+    assert cols[0].tolist() == [1, 3]
+    assert cols[1].tolist() == [2.5, 4.5]
+    assert cols[2].tolist() == [b'x', b'yy']
+    for col, arr in zip(cols, out):
+        assert np.shares_memory(col, arr)
+    assert out[0][:2].tolist() == [1, 3]
+
+
+def test_out_reuse():
+    with th.TempCsvFile('a,b\n' + ''.join('%d,%d.5\n' % (i, i) for i in range(1000))) as fname:
+        _, first = camog.load(fname, nthreads=3)
+        _, second = camog.load(fname, nthreads=3, out=first)
+
+    assert np.shares_memory(second[0], first[0])
+    assert second[0].tolist() == list(range(1000))
+
+
+def test_out_errors():
+    data = 'a,b\n1,2.5\n3,4.5\n'
+
+    with pytest.raises(ValueError, match='rows'):
+        camog.loads(data, out=[np.zeros(1, np.int64), np.zeros(2)])
+    with pytest.raises(ValueError, match='dtype'):
+        camog.loads(data, out=[np.zeros(2), np.zeros(2)])
+    with pytest.raises(ValueError, match='more columns'):
+        camog.loads(data, out=[np.zeros(2, np.int64)])
+    with pytest.raises(ValueError, match='S1'):
+        camog.loads('a\nx\n', out=[np.zeros(2, 'S2')])
+    with pytest.raises(ValueError, match='dtype'):
+        camog.loads(data, out=[np.zeros(2, '>i8'), np.zeros(2, '>f8')])
+
+
+def test_out_overlap():
+    data = 'a,b\n1,3\n2,4\n'
+    x = np.zeros(4, np.int64)
+
+    with pytest.raises(ValueError, match='overlaps'):
+        camog.loads(data, out=[x, x])
+    with pytest.raises(ValueError, match='overlaps'):
+        camog.loads(data, out=[x, x[1:]])
+
+    _, cols = camog.loads(data, out=[x, x[2:]])
+    assert cols[0].tolist() == [1, 2]
+    assert cols[1].tolist() == [3, 4]
@@ -0,0 +1,84 @@
+# Copyright 2026 Ben Walsh
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+
+import numpy as np
+import pytest
+
+import camog
+
+import _testhelper as th
+
+def _check_parts(cols, parts, key_idx):
+    """Each partition has its rows in file order, and each key is in one
+    partition."""
+
+    assert sum(len(part[0]) for part in parts) == len(cols[0])
+    owner = {}
+    for i, part in enumerate(parts):
+        assert len(part) == len(cols)
+        assert np.all(np.diff(part[0]) > 0)
+        for col, part_col in zip(cols, part):
+            assert np.all(part_col == col[part[0]])
+        for key in part[key_idx].tolist():
+            assert owner.setdefault(key, i) == i
+
+
+def test_partition():
+    data = 'row,cust,px,name\n' + ''.join('%d,%d,%d.25,"n%d"\n' % (i, i % 37, i, i % 11)
+                                          for i in range(5000))
+
+    with th.TempCsvFile(data) as fname:
+        headers, cols = camog.load(fname, nthreads=4)
+        for key in ('cust', 2, 'name'):
+            headers2, parts = camog.load(fname, nthreads=4, partition_by=key, npartitions=8)
+            assert headers2 == headers
+            assert len(parts) == 8
+            _check_parts(cols, parts, key if isinstance(key, int) else headers.index(key))
+
+
+def test_partition_same_key():
+    data1 = 'k,v\n"abc",1\n7,2\n'
+    data2 = 'k,v\nabc,3\n007,4\nlonger key,5\n'
+
+    with th.TempCsvFile(data1) as fname:
+        _, parts1 = camog.load(fname, partition_by='k', npartitions=16)
+    with th.TempCsvFile(data2) as fname:
+        _, parts2 = camog.load(fname, partition_by='k', npartitions=16)
+
+    def where(parts, v):
+        return [i for i, part in enumerate(parts) if v in part[1].tolist()][0]
+
+    assert where(parts1, 1) == where(parts2, 3)
+
+
+def test_partition_filter():
+    data = 'a,b\n' + ''.join('%d,%d\n' % (i, i % 5) for i in range(1000))
+
+    with th.TempCsvFile(data) as fname:
+        _, parts = camog.load(fname, nthreads=3, partition_by='b', npartitions=2,
+                              filter=('<', 'a', 100))
+
+    assert sum(len(part[0]) for part in parts) == 100
+    assert sorted(np.concatenate([part[0] for part in parts]).tolist()) == list(range(100))
+
+
+def test_partition_errors():
+    with th.TempCsvFile('a,b\n1,2\n') as fname:
+        with pytest.raises(ValueError):
+            camog.load(fname, partition_by='zzz', npartitions=2)
+        with pytest.raises(ValueError):
+            camog.load(fname, partition_by='a', npartitions=0)
+        with pytest.raises(ValueError):
+            camog.load(fname, partition_by='a', npartitions=2, validity='mask')
@@ -0,0 +1,68 @@
+# Copyright 2026 Ben Walsh
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+
+import numpy as np
+
+import camog
+
+import _testhelper as th
+
+def test_scan():
+    data = 'a,b,c\n' + ''.join('%d,%d.5,"x%d"\n' % (i, i, i) for i in range(1000))
+
+    with th.TempCsvFile(data) as fname:
+        res = camog.scan(fname, nthreads=3)
+        headers, cols = camog.load(fname, nthreads=3)
+
+    assert res['headers'] == headers
+    assert res['nrows'] == 1000
+    assert res['ncols'] == 3
+    assert res['dtypes'] == [col.dtype for col in cols]
+    assert res['widths'] == [3, 5, 4]
+    assert res['quoted'] == [0, 0, 1000]
+    assert res['fixup_bytes'] == 0
+    assert res['nchunks_reparsed'] == 0
+
+
+def test_scan_types():
+    data = 'a,b,c\n1,,NA\n300,x,2.5\n'
+
+    with th.TempCsvFile(data) as fname:
+        res = camog.scan(fname, narrow='int_only', na_values=['NA'])
+
+    assert res['dtypes'] == [np.dtype(np.int16), np.dtype('S1'), np.dtype(np.float64)]
+
+
+def test_scan_fixup():
+    csv_str = '"aaaaaaaaaaaaaaaa\n"\n\n' + ''.join(',%d\n' % i for i in range(1, 10))
+
+    with th.TempCsvFile(csv_str) as fname:
+        res = camog.scan(fname, headers=False, nthreads=3)
+
+    assert res['nrows'] == 11
+    assert res['quoted'] == [1, 0]
+    assert res['nchunks_reparsed'] > 0
+    assert res['fixup_bytes'] > 0
+
+
+def test_scan_empty():
+    with th.TempCsvFile('a,b\n') as fname:
+        res = camog.scan(fname)
+        headers, cols = camog.load(fname)
+
+    assert res['headers'] == headers
+    assert res['nrows'] == 0
+    assert res['ncols'] == len(cols)
+    assert res['dtypes'] == [col.dtype for col in cols]
@@ -0,0 +1,94 @@
+# Copyright 2026 Ben Walsh
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+
+import numpy as np
+import pytest
+
+import camog
+
+
+def _csv(nrows, seed=3):
+    rng = np.random.RandomState(seed)
+    words = ['abc', '"x,y"', '"say ""hi"""', '"two\nlines"', '', 'a"b', 'longer text with no quotes']
+    lines = ['a,b,c,d']
+    for i in range(nrows):
+        lines.append('%d,%r,%s,%s' % (rng.randint(-10 ** 9, 10 ** 9), rng.standard_normal(),
+                                      words[rng.randint(0, len(words))],
+                                      words[rng.randint(0, len(words))]))
+    return ('\n'.join(lines) + '\n').encode('utf8')
+
+
+@pytest.mark.parametrize('nthreads', [1, 3, 8])
+@pytest.mark.parametrize('strtype', [bytes, 'S40'])
+def test_schema_same_as_inferred(nthreads, strtype):
+    s = _csv(5000)
+    headers, exp = camog.loads(s, nthreads=nthreads)
+    headers2, res = camog.loads(s, nthreads=nthreads, schema=[int, float, strtype, strtype])
+    assert headers2 == headers == ['a', 'b', 'c', 'd']
+    assert [col.dtype.kind for col in res] == ['i', 'f', 'S', 'S']
+    for x, y in zip(res, exp):
+        assert np.array_equal(x, y)
+
+
+def test_schema_types():
+    s = b'1,2.5,3,x\n-4,"5",6,yy\n'
+    _, res = camog.loads(s, headers=False,
+                         schema=[np.int8, np.float32, np.int32, np.dtype('S1')])
+    assert [col.dtype for col in res] == [np.int8, np.float32, np.int32, np.dtype('S1')]
+    assert list(res[0]) == [1, -4]
+    assert list(res[1]) == [2.5, 5.0]
+    assert list(res[3]) == [b'x', b'y']
+
+
+@pytest.mark.parametrize('nthreads', [1, 4])
+def test_schema_truncates(nthreads):
+    long_cell = 'z' * 100
+    rows = ['%s,"%s",%d' % (long_cell, long_cell, i) for i in range(1000)]
+    rows.append('abcdef,"ab""cdef",7')
+    s = '\n'.join(rows).encode('utf8')
+    _, res = camog.loads(s, headers=False, nthreads=nthreads, schema=['S3', 'S4', int])
+    assert list(res[0][:2]) == [b'zzz', b'zzz']
+    assert list(res[1][:2]) == [b'zzzz', b'zzzz']
+    assert list(res[2][:3]) == [0, 1, 2]
+    assert (res[0][-1], res[1][-1], res[2][-1]) == (b'abc', b'ab"c', 7)
+
+
+@pytest.mark.parametrize('schema', [[int, int], [float, float], [int, str]])
+def test_schema_ragged(schema):
+    s = b'1,2,3,4\n5\n6,7,"8\n9",10\n11,12'
+    _, res = camog.loads(s, headers=False, nthreads=2, missing_int_val=-1,
+                         missing_float_val=-1.0, schema=schema)
+    assert len(res) == 2
+    assert list(res[0]) == [1, 5, 6, 11]
+    assert list(res[1]) == [2, -1, 7, 12] or list(res[1]) == [b'2', b'', b'7', b'12']
+
+
+def test_schema_decimals():
+    _, res, scales = camog.loads(b'px\n1.25\n3\n', schema=[float], decimals={'px': 2})
+    assert list(res[0]) == [125, 300]
+    assert scales == [2]
+
+
+def test_schema_errors():
+    with pytest.raises(ValueError):
+        camog.loads(b'1\n', schema=[int], col_to_type={0: float})
+    with pytest.raises(ValueError):
+        camog.loads(b'1\n', schema=[float], decimals=[0])
+    with pytest.raises(TypeError):
+        camog.loads(b'1\n', schema=[list])
+    with pytest.raises(ValueError):
+        camog.loads(b'a,b\n1,2\n', schema=[])
+    with pytest.raises(ValueError):
+        camog._cfastcsv.parse_csv(b'a,b\n1,2\n', ',', schema=[])
@@ -0,0 +1,87 @@
+# Copyright 2026 Ben Walsh
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+
+import os
+
+import numpy as np
+import pytest
+
+import camog
+
+
+def _write(fname, nrows):
+    with open(fname, 'w') as fh:
+        fh.write('a,b,c,d,e\n')
+        for i in range(nrows):
+            fh.write('%d,%.3f,s%d,%d,"%s"\n' % (i, i * 0.25, i % 1000, i % 7,
+                                              'q\n' * (i % 3) if i % 5 else ''))
+
+
+def _check_same(res, exp):
+    assert res[0] == exp[0]
+    assert len(res[1]) == len(exp[1])
+    for col, exp_col in zip(res[1], exp[1]):
+        assert col.dtype == exp_col.dtype
+        assert np.array_equal(col, exp_col)
+
+
+@pytest.mark.parametrize('nthreads', [1, 3, 8])
+@pytest.mark.parametrize('memory_limit', [1, 100000, 10 ** 12])
+def test_spill_same(tmp_path, nthreads, memory_limit):
+    fname = os.path.join(tmp_path, 'in.csv')
+    _write(fname, 50000)
+    exp = camog.load(fname, nthreads=nthreads)
+    res = camog.load(fname, nthreads=nthreads, memory_limit=memory_limit, spill_dir=str(tmp_path))
+    _check_same(res, exp)
+    assert os.listdir(tmp_path) == ['in.csv']  # unlinked while mapped
+
+
+def test_spill_options(tmp_path):
+    fname = os.path.join(tmp_path, 'in.csv')
+    _write(fname, 20000)
+    kwargs = dict(filter=('>', 'a', 777), na_values=['s3'], validity='mask', narrow='auto',
+                  decimals={'b': 2})
+    exp = camog.load(fname, nthreads=3, **kwargs)
+    res = camog.load(fname, nthreads=3, memory_limit=1000, **kwargs)
+    assert res[2] == exp[2]
+    _check_same(res[:2], exp[:2])
+    for col, exp_col in zip(res[1], exp[1]):
+        assert np.array_equal(col.mask, exp_col.mask)
+
+
+def test_spill_load_many(tmp_path):
+    fnames = [os.path.join(tmp_path, 'in%d.csv' % i) for i in range(3)]
+    for fname in fnames:
+        _write(fname, 3000)
+    exp = camog.load_many(fnames, nthreads=2)
+    res = camog.load_many(fnames, nthreads=2, memory_limit=1)
+    _check_same(res, exp)
+
+
+def test_spill_no_dir(tmp_path):
+    fname = os.path.join(tmp_path, 'in.csv')
+    _write(fname, 1000)
+    exp = camog.load(fname)
+    res = camog.load(fname, memory_limit=1, spill_dir=os.path.join(tmp_path, 'nosuch'))
+    _check_same(res, exp)
+
+
+def test_spill_errors(tmp_path):
+    fname = os.path.join(tmp_path, 'in.csv')
+    _write(fname, 10)
+    with pytest.raises(ValueError):
+        camog.load(fname, memory_limit=0)
+    with pytest.raises(ValueError):
+        camog.load(fname, memory_limit=1.5)
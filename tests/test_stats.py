@@ -0,0 +1,82 @@
+# Copyright 2026 Ben Walsh
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import numpy as np
+
+import camog
+
+import _testhelper as th
+
+def test_stats():
+    data = 'abc,def\n' + ''.join('%d,x%d\n' % (i, i) for i in range(1000))
+
+    headers, cols, stats = camog.loads(data, nthreads=3, return_stats=True)
+
+    assert headers == ['abc', 'def']
+    assert np.all(cols[0] == np.arange(1000))
+
+    assert 0.0 <= stats['stage1_begin'] <= stats['stage1_end']
+    assert stats['stage1_end'] <= stats['fixup_begin'] <= stats['fixup_end']
+    assert stats['fixup_end'] <= stats['allocate_begin'] <= stats['allocate_end']
+    assert stats['allocate_end'] <= stats['fill_begin'] <= stats['fill_end']
+    assert 0.0 <= stats['add_column_time'] <= stats['allocate_end'] - stats['allocate_begin']
+    assert stats['n_string_cols'] == 1
+    assert stats['fixup_bytes'] == 0
+    assert stats['nchunks_reparsed'] == 0
+
+    chunks = stats['chunks']
+    assert len(chunks) == 3
+    assert sum(c['nrows'] for c in chunks) == 1000
+    assert sum(c['nbytes'] for c in chunks) == len(data) - len('abc,def\n')
+    for c in chunks:
+        assert c['stage1_begin'] <= c['stage1_end'] <= c['fill_begin'] <= c['fill_end']
+        assert c['stage1_wait'] >= 0.0 and c['fill_wait'] >= 0.0
+    assert stats['queue_wait'] >= 0.0
+
+
+def test_stats_fixup():
+    csv_str = '''"aaaaaaaaaaaaaaaa
+"
+
+,1
+,2
+,3
+,4
+,5
+,6
+,7
+,8
+,9
+'''
+
+    _, cols, stats = camog.loads(csv_str, headers=False, nthreads=3, return_stats=True)
+
+    assert np.all(cols[1] == th.array([0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9]))
+    assert stats['nchunks_reparsed'] > 0
+    assert stats['fixup_bytes'] > 0
+
+
+def test_no_stats():
+    res = camog.loads('a\n1\n')
+
+    assert len(res) == 2
+
+
+def test_load_stats():
+    with th.TempCsvFile('a,b\n1,2\n') as fname:
+        headers, cols, stats = camog.load(fname, nthreads=1, return_stats=True)
+
+    assert headers == ['a', 'b']
+    assert len(stats['chunks']) == 1
+    assert stats['chunks'][0]['nrows'] == 1
@@ -0,0 +1,108 @@
+# Copyright 2026 Ben Walsh
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import math
+
+import numpy as np
+import pytest
+
+import camog
+
+import _testhelper as th
+
+
+def _data(nrows):
+    lines = ['i,f,s']
+    for row in range(nrows):
+        i = '' if row % 17 == 0 else str((row * 7919) % 1000 - 500)
+        if row % 23 == 0:
+            f = ''
+        elif row % 29 == 0:
+            f = 'nan'
+        else:
+            f = '%d.5' % ((row * 31) % 200 - 100)
+        s = '' if row % 13 == 0 else '"s%d"' % (row % 300)
+        lines.append('%s,%s,%s' % (i, f, s))
+    return '\n'.join(lines) + '\n'
+
+
+@pytest.mark.parametrize('nthreads', [1, 3, 8])
+def test_summary(nthreads):
+    nrows = 5000
+    headers, cols, summary = camog.loads(_data(nrows), nthreads=nthreads,
+                                         return_summary=True)
+
+    assert len(summary) == 3
+    i_stats, f_stats, s_stats = summary
+
+    present = np.array([row % 17 != 0 for row in range(nrows)])
+    ivals = cols[0][present]
+    assert i_stats['count'] == len(ivals)
+    assert i_stats['nulls'] == nrows - len(ivals)
+    assert i_stats['nans'] == 0
+    assert i_stats['min'] == ivals.min()
+    assert i_stats['max'] == ivals.max()
+    assert i_stats['sum'] == ivals.sum()
+    assert abs(i_stats['ndistinct'] - len(set(ivals))) < 0.05 * len(set(ivals))
+
+    fvals = cols[1][np.array([row % 23 != 0 for row in range(nrows)])]
+    nans = np.isnan(fvals)
+    fvals = fvals[~nans]
+    assert f_stats['count'] == len(fvals)
+    assert f_stats['nans'] == nans.sum()
+    assert f_stats['nulls'] == nrows - len(fvals) - nans.sum()
+    assert f_stats['min'] == fvals.min()
+    assert f_stats['max'] == fvals.max()
+    assert math.isclose(f_stats['sum'], fvals.sum())
+    assert abs(f_stats['ndistinct'] - len(set(fvals))) < 0.05 * len(set(fvals))
+
+    svals = [v for v in cols[2] if v]
+    assert s_stats['count'] == len(svals)
+    assert s_stats['nulls'] == nrows - len(svals)
+    assert s_stats['min'] is None
+    assert s_stats['sum'] is None
+    assert abs(s_stats['ndistinct'] - len(set(svals))) < 0.05 * len(set(svals))
+
+
+def test_summary_with_stats():
+    res = camog.loads('a,b\n1,x\n2,y\n', return_stats=True, return_summary=True)
+    assert len(res) == 4
+    assert 'chunks' in res[2]
+    assert [col['count'] for col in res[3]] == [2, 2]
+
+
+def test_summary_empty_column():
+    headers, cols, summary = camog.loads('a,b\n,1\n,2\n', return_summary=True)
+    assert summary[0]['count'] == 0
+    assert summary[0]['nulls'] == 2
+    assert summary[0]['min'] is None
+    assert summary[0]['ndistinct'] == 0.0
+    assert summary[1]['min'] == 1
+    assert summary[1]['max'] == 2
+
+
+def test_summary_filter():
+    data = 'a,b\n' + ''.join('%d,%d\n' % (i, i * 10) for i in range(100))
+    headers, cols, summary = camog.loads(data, filter=('<', 'a', 10), nthreads=3,
+                                         return_summary=True)
+    assert summary[1]['count'] == 10
+    assert summary[1]['max'] == 90
+    assert summary[1]['sum'] == 450
+
+
+def test_summary_distinct_large():
+    nrows = 100000
+    data = 'a\n' + ''.join('%d\n' % (i % 40000) for i in range(nrows))
+    headers, cols, summary = camog.loads(data, nthreads=4, return_summary=True)
+    assert abs(summary[0]['ndistinct'] - 40000) < 0.05 * 40000
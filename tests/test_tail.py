@@ -0,0 +1,123 @@
+# Copyright 2026 Ben Walsh
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+
+import os
+
+import numpy as np
+import pytest
+
+import camog
+
+
+def _check(tail, fname, **kwargs):
+    headers, columns = camog.load(fname, **kwargs)
+    assert tail.headers == headers
+    assert len(tail) == len(columns[0])
+    for col, exp in zip(tail.columns, columns):
+        assert col.dtype == exp.dtype
+        assert np.array_equal(col, exp)
+
+
+@pytest.mark.parametrize('nthreads', [1, 3, 8])
+def test_tail_appends(tmp_path, nthreads):
+    fname = os.path.join(tmp_path, 'log.csv')
+    rng = np.random.RandomState(42)
+    lines = ['%d,%s,"%s"\n' % (i, '' if i % 7 == 0 else i * 10, 's\n' * (i % 3))
+             for i in range(2000)]
+    data = 'a,b,c\n' + ''.join(lines)
+    with open(fname, 'w') as fh:
+        pass
+    tail = camog.Tail(fname, nthreads=nthreads)
+    assert tail.refresh() == []
+
+    pos = 0
+    while pos < len(data):
+        end = min(len(data), pos + rng.randint(1, 3000))
+        with open(fname, 'a') as fh:
+            fh.write(data[pos:end])
+        pos = end
+        nrows = len(tail)
+        delta = tail.refresh()
+        if tail.headers is not None:
+            assert len(tail) == nrows + len(delta[0])
+            assert np.array_equal(tail.columns[0][nrows:], delta[0])
+    _check(tail, fname)
+    assert len(tail) == 2000
+
+
+def test_tail_partial_row(tmp_path):
+    fname = os.path.join(tmp_path, 'log.csv')
+    with open(fname, 'w') as fh:
+        fh.write('a,b\n1,"x\n')
+    tail = camog.Tail(fname)
+    assert [len(col) for col in tail.refresh()] == []
+    assert tail.headers == ['a', 'b']
+    with open(fname, 'a') as fh:
+        fh.write('y"\n2,z')
+    assert [list(col) for col in tail.refresh()] == [[1], [b'x\ny']]
+    with open(fname, 'a') as fh:
+        fh.write('z\n')
+    assert [list(col) for col in tail.refresh()] == [[2], [b'zz']]
+    _check(tail, fname)
+
+
+def test_tail_promotes(tmp_path):
+    fname = os.path.join(tmp_path, 'log.csv')
+    with open(fname, 'w') as fh:
+        fh.write('a,b,c,d\n1,2.5,x,1\n')
+    tail = camog.Tail(fname, missing_float_val=-1.0)
+    tail.refresh()
+    steps = ['2,,,\n', '3,7,a longer string,2\n', '4.5,1,y,5000000000\n',
+             'x,2,3,4\n', '5,6,7,8,9\n']
+    for step in steps:
+        with open(fname, 'a') as fh:
+            fh.write(step)
+        tail.refresh()
+        _check(tail, fname, missing_float_val=-1.0)
+
+
+def test_tail_truncated(tmp_path):
+    fname = os.path.join(tmp_path, 'log.csv')
+    with open(fname, 'w') as fh:
+        fh.write('a\n1\n2\n3\n')
+    tail = camog.Tail(fname)
+    tail.refresh()
+    with open(fname, 'w') as fh:
+        fh.write('b\n4\n')
+    tail.refresh()
+    assert tail.headers == ['b']
+    assert list(tail.columns[0]) == [4]
+
+
+def test_tail_no_headers(tmp_path):
+    fname = os.path.join(tmp_path, 'log.csv')
+    with open(fname, 'w') as fh:
+        fh.write('1,2\n3,4\n')
+    tail = camog.Tail(fname, headers=False, col_to_type={1: float})
+    tail.refresh()
+    with open(fname, 'a') as fh:
+        fh.write('5,6\n')
+    assert [list(col) for col in tail.refresh()] == [[5], [6.0]]
+    assert tail.headers is None
+    assert [list(col) for col in tail.columns] == [[1, 3, 5], [2.0, 4.0, 6.0]]
+
+
+def test_tail_quoted_header(tmp_path):
+    fname = os.path.join(tmp_path, 'log.csv')
+    with open(fname, 'w') as fh:
+        fh.write('"a\nb",c\n1,2\n')
+    tail = camog.Tail(fname)
+    tail.refresh()
+    _check(tail, fname)
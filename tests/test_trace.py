@@ -0,0 +1,86 @@
+# Copyright 2026 Ben Walsh
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import os
+import json
+import tempfile
+
+import numpy as np
+import pytest
+
+import camog
+
+def _load_trace(fname):
+    with open(fname) as fp:
+        return json.load(fp)['traceEvents']
+
+
+def test_trace():
+    data = 'abc,def\n' + ''.join('%d,x%d\n' % (i, i) for i in range(1000))
+
+    fd, fname = tempfile.mkstemp(suffix='.json')
+    os.close(fd)
+    try:
+        headers, cols = camog.loads(data, nthreads=3, trace=fname)
+        events = _load_trace(fname)
+    finally:
+        os.unlink(fname)
+
+    assert np.all(cols[0] == np.arange(1000))
+
+    spans = [e for e in events if e['ph'] == 'X']
+    main_names = [e['name'] for e in spans if e['tid'] == 0]
+    assert main_names == ['stage1', 'fixup', 'allocate', 'fill']
+
+    worker_spans = [e for e in spans if e['tid'] != 0]
+    for name in ('stage1', 'fill_arrays', 'queue_pop'):
+        assert any(e['name'] == name for e in worker_spans)
+    assert sorted(e['args']['chunk'] for e in worker_spans
+                  if e['name'] == 'stage1') == [0, 1, 2]
+    assert sum(e['args']['nrows'] for e in worker_spans
+               if e['name'] == 'fill_arrays') == 1000
+    for e in spans:
+        assert e['ts'] >= 0.0 and e['dur'] >= 0.0
+
+    thread_names = set(e['args']['name'] for e in events if e['ph'] == 'M')
+    assert 'main' in thread_names
+    for tid in set(e['tid'] for e in worker_spans):
+        assert 'reader %d' % (tid - 1) in thread_names
+
+
+def test_trace_env():
+    fd, fname = tempfile.mkstemp(suffix='.json')
+    os.close(fd)
+    os.environ['CAMOG_TRACE'] = fname
+    try:
+        camog.loads('abc\n1\n2\n', nthreads=2)
+        events = _load_trace(fname)
+    finally:
+        del os.environ['CAMOG_TRACE']
+        os.unlink(fname)
+
+    assert any(e['name'] == 'fill_arrays' for e in events)
+
+
+def test_trace_unwritable():
+    tmpdir = tempfile.mkdtemp()
+    try:
+        fname = os.path.join(tmpdir, 'nosuch', 'trace.json')
+        with pytest.warns(RuntimeWarning, match='could not write trace'):
+            headers, cols = camog.loads('abc\n1\n2\n', trace=fname)
+    finally:
+        os.rmdir(tmpdir)
+
+    assert headers == ['abc']
+    assert np.all(cols[0] == np.array([1, 2]))